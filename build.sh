@@ -6,6 +6,10 @@ set -e
 REVISION=99
 BUILD_TYPE="release"
 REBUILD=false
+ASM_KERNELS=false
+AUTOPLAY=false
+KERNELS_TEST=false
+TRACE=false
 
 # Parse arguments
 while [[ $# -gt 0 ]]; do
@@ -20,8 +24,8 @@ while [[ $# -gt 0 ]]; do
       ;;
     -b|--build-type)
       BUILD_TYPE="${2,,}" # lowercase
-      if [[ ! "$BUILD_TYPE" =~ ^(debug|release|clean|asm)$ ]]; then
-        echo "Error: Build type must be Debug, Release, Clean, or ASM" >&2
+      if [[ ! "$BUILD_TYPE" =~ ^(debug|release|profile|clean|asm)$ ]]; then
+        echo "Error: Build type must be Debug, Release, Profile, Clean, or ASM" >&2
         exit 1
       fi
       shift 2
@@ -30,8 +34,24 @@ while [[ $# -gt 0 ]]; do
       REBUILD=true
       shift
       ;;
+    --asm-kernels)
+      ASM_KERNELS=true
+      shift
+      ;;
+    --autoplay)
+      AUTOPLAY=true
+      shift
+      ;;
+    --kernels-test)
+      KERNELS_TEST=true
+      shift
+      ;;
+    --trace)
+      TRACE=true
+      shift
+      ;;
     -h|--help)
-      echo "Usage: $0 [-r|--revision <0-99>] [-b|--build-type <Debug|Release|Clean|ASM>] [--rebuild]"
+      echo "Usage: $0 [-r|--revision <0-99>] [-b|--build-type <Debug|Release|Profile|Clean|ASM>] [--rebuild] [--asm-kernels] [--autoplay] [--kernels-test] [--trace]"
       exit 0
       ;;
     *)
@@ -57,12 +77,73 @@ CONTENTS="${CONTENTS//\{Revision2Digits\}/$REVISION_2_DIGITS}"
 
 echo "$CONTENTS" > "$GAME_ROOT/src/rom_header.c"
 
-if [[ "$BUILD_TYPE" == "debug" || "$BUILD_TYPE" == "release" ]]; then
+# Generate build configuration, changing it needs a --rebuild
+DEFINES=""
+
+if [ "$ASM_KERNELS" = true ]; then
+  DEFINES+="#define ASM_KERNELS"$'\n'
+fi
+
+if [ "$AUTOPLAY" = true ]; then
+  DEFINES+="#define AUTOPLAY"$'\n'
+fi
+
+if [ "$KERNELS_TEST" = true ]; then
+  DEFINES+="#define KERNELS_TEST"$'\n'
+fi
+
+# debug builds always trace, profile builds do too so the instrumentation
+# stays on while measuring
+if [ "$TRACE" = true ] || [ "$BUILD_TYPE" = "profile" ]; then
+  DEFINES+="#define TRACE"$'\n'
+fi
+
+CONTENTS=$(<"$GAME_ROOT/cfg/build_config.h.in")
+CONTENTS="${CONTENTS//\{Defines\}/$DEFINES}"
+
+echo "$CONTENTS" > "$GAME_ROOT/inc/build_config.h"
+
+# Generate collision maps, listing the terrain palette indices of each map.
+# stage-1 has no terrain yet, 1 is only its dashed border and 2 the backdrop
+python "$ROOT/tools/collision.py" "$GAME_ROOT/res/maps/stage-1.png" \
+  "$GAME_ROOT/res/maps/stage-1-collision.bin" --solid
+
+for BOSS in "$GAME_ROOT"/res/bosses/*.png; do
+  python "$ROOT/tools/collision.py" --opaque "$BOSS" "${BOSS%.png}-collision.bin"
+done
+
+# Generate hitboxes
+python "$ROOT/tools/hitbox.py" "$GAME_ROOT/res/sprites.res" \
+  "$GAME_ROOT/res/hitboxes" k_shipSprite k_mineSprite
+
+# Generate motion paths
+python "$ROOT/tools/path.py" "$GAME_ROOT/res/paths.txt" "$GAME_ROOT/res/paths"
+
+# Compile enemy scripts
+python "$ROOT/tools/script.py" "$GAME_ROOT/res/scripts.txt" \
+  "$GAME_ROOT/res/paths.txt" "$GAME_ROOT/res/scripts"
+
+if [[ "$BUILD_TYPE" =~ ^(debug|release|profile)$ ]]; then
   IS_BUILD=true
 else
   IS_BUILD=false
 fi
 
+# Profile is a release build with extra flags from cfg/profile.mk
+if [ "$BUILD_TYPE" = "profile" ]; then
+  MAKE_TARGET="release"
+else
+  MAKE_TARGET="$BUILD_TYPE"
+fi
+
+# Objects built for another build type would be reused as they are, so a
+# change of build type since the last one, or not knowing it, is a rebuild
+BUILD_TYPE_STAMP="$GAME_ROOT/out/build_type"
+
+if [ "$IS_BUILD" = true ] && [ "$(cat "$BUILD_TYPE_STAMP" 2>/dev/null)" != "$BUILD_TYPE" ]; then
+  REBUILD=true
+fi
+
 # Remove checksum corrected ROM
 if { [ "$IS_BUILD" = true ] && [ "$REBUILD" = true ]; } || [ "$BUILD_TYPE" = "clean" ]; then
   if [ -f "$GAME_ROOT/out/rom_final.bin" ]; then
@@ -76,16 +157,38 @@ PATH="$SGDK_ROOT/bin:$PATH"
 
 cd "$SGDK_ROOT"
 
-make -f "$SGDK_ROOT/makelib.gen" "$BUILD_TYPE"
+make -f "$SGDK_ROOT/makelib.gen" "$MAKE_TARGET"
 
 # Build game
 cd "$GAME_ROOT"
 
+MAKE_FILES=(-f "$SGDK_ROOT/makefile.gen")
+
+if [ "$BUILD_TYPE" = "profile" ]; then
+  MAKE_FILES+=(-f "$GAME_ROOT/cfg/profile.mk")
+fi
+
 if [ "$IS_BUILD" = true ] && [ "$REBUILD" = true ]; then
   make -f "$SGDK_ROOT/makefile.gen" clean
 fi
 
-make -f "$SGDK_ROOT/makefile.gen" "$BUILD_TYPE"
+make "${MAKE_FILES[@]}" "$MAKE_TARGET"
+
+if [ "$IS_BUILD" = true ]; then
+  echo "$BUILD_TYPE" > "$BUILD_TYPE_STAMP"
+else
+  rm -f "$BUILD_TYPE_STAMP"
+fi
+
+# Report hot data placement
+if [ "$IS_BUILD" = true ]; then
+  python "$ROOT/tools/hot_data.py" "$GAME_ROOT/out/symbol.txt"
+fi
+
+# Report size per module and the code of the hot functions
+if [ "$BUILD_TYPE" = "profile" ]; then
+  python "$ROOT/tools/profile.py"
+fi
 
 # Correct ROM checksum
 if [ "$IS_BUILD" = true ]; then
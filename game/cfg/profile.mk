@@ -0,0 +1,20 @@
+# Read after SGDK's makefile.gen for the Profile build type, which is the
+# release build with the changes below. Release already compiles with -O3 and
+# links with LTO and --gc-sections. LTO keeps the options each function was
+# compiled with, so the per-file overrides still hold after the link.
+
+# one section per function and variable so --gc-sections can drop each unused
+# one on its own, debug info lets tools/profile.py map symbols back to files
+release: FLAGS += -g -ffunction-sections -fdata-sections
+
+# hot translation units, the per-frame walks and what they call
+PROFILE_HOT := actor managed_actor kernels hitbox particles stage camera \
+  actors/player actors/enemies/enemy actors/enemies/mine \
+  actors/enemies/homing_mine actors/enemies/mine_formation \
+  actors/enemies/scripted_mine
+
+# cold translation units, only run while loading or outside of gameplay
+PROFILE_COLD := game/logo game/menu game/load game/credits hud arena trace
+
+$(PROFILE_HOT:%=out/src/%.o): FLAGS += -funroll-loops
+$(PROFILE_COLD:%=out/src/%.o): FLAGS += -Os
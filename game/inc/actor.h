@@ -28,38 +28,63 @@
 #include "camera.h"
 #include "stage.h"
 
+// constants
+
+#define ACTOR_HANDLE_NONE 0  // generation 0 never resolves
+
+// live actors at once, host benchmarks raise it up to the 256 a handle's slot
+// byte can tell apart
+#ifndef ACTOR_HANDLES_MAX
+#define ACTOR_HANDLES_MAX 64
+#endif
+
 // entity
 
 struct _Actor;
 typedef struct _Actor Actor;
 
+// slot in the low byte, generation in the high byte, a handle stays safe to
+// hold after its actor is gone and just stops resolving
+typedef u16 ActorHandle;
+
 typedef void (*ActorUpdateCallback)(Actor* _actor, const Stage* _stage);
-typedef void (*ActorDrawCallback)(const Actor* _actor, const Camera* _camera);
+typedef void (*ActorDrawCallback)(const Actor* _actor);
 typedef void (*ActorDestroyCallback)(Actor* _actor);
 
 struct _Actor {
-  V2f32 position;
+  V2f16 position;        // pixels, relative to the stage chunk origin
+  V2s16 extent;          // pixels, half size used for projection and culling
+  V2s16 screenPosition;  // pixels, top left of the actor on screen
+  bool onScreen;
+  bool wasOnScreen;
   void* data;
   ActorUpdateCallback updateCallback;
   ActorDrawCallback drawCallback;
   ActorDestroyCallback destroyCallback;
+  ActorHandle handle;
 };
 
 // life-cycle
 
-Actor* createActor(V2f32 _position, void* _data,
+void initActors();
+
+// NULL when the arena is full or every handle is taken
+Actor* createActor(V2f16 _position, void* _data,
                    ActorUpdateCallback _updateCallback,
                    ActorDrawCallback _drawCallback,
                    ActorDestroyCallback _destroyCallback);
 
-void setUpActor(Actor* _actor, V2f32 _position, void* _data,
+// FALSE when every handle is taken, the actor is left unusable
+bool setUpActor(Actor* _actor, V2f16 _position, void* _data,
                 ActorUpdateCallback _updateCallback,
                 ActorDrawCallback _drawCallback,
                 ActorDestroyCallback _destroyCallback);
 
 void updateActor(Actor* _actor, const Stage* _stage);
 
-void drawActor(const Actor* _actor, const Camera* _camera);
+void projectActor(Actor* _actor, const CameraView* _view);
+
+void drawActor(const Actor* _actor);
 
 void tearDownActor(Actor* _actor);
 
@@ -67,20 +92,34 @@ void destroyActor(Actor* _actor);
 
 // properties
 
-V2f32 getActorPosition(const Actor* _actor);
+V2f16 getActorPosition(const Actor* _actor);
+
+f16 getActorPositionX(const Actor* _actor);
 
-f32 getActorPositionX(const Actor* _actor);
+f16 getActorPositionY(const Actor* _actor);
 
-f32 getActorPositionY(const Actor* _actor);
+void setActorPosition(Actor* _actor, V2f16 _position);
 
-void setActorPosition(Actor* _actor, V2f32 _position);
+V2s16 getActorExtent(const Actor* _actor);
+
+void setActorExtent(Actor* _actor, V2s16 _extent);
+
+V2s16 getActorScreenPosition(const Actor* _actor);
+
+bool isActorOnScreen(const Actor* _actor);
 
 void* getActorData(const Actor* _actor);
 
+ActorHandle getActorHandle(const Actor* _actor);
+
 // utilities
 
-V2f32 getDirectionTowardsActor(const Actor* _actor, const Actor* _target);
+Actor* resolveActorHandle(ActorHandle _handle);
+
+V2f16 getDirectionTowardsActor(const Actor* _actor, const Actor* _target);
+
+f16 getDistanceBetweenActors(const Actor* _actor1, const Actor* _actor2);
 
-f32 getDistanceBetweenActors(const Actor* _actor1, const Actor* _actor2);
+bool isActorBehindStage(const Actor* _actor, const Stage* _stage);
 
 #endif  // __QUANTUM_BURST_ACTOR_H__
@@ -0,0 +1,51 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __QUANTUM_BURST_ACTORS_ENEMIES_ENEMY_H__
+#define __QUANTUM_BURST_ACTORS_ENEMIES_ENEMY_H__
+
+#include <genesis.h>
+
+// entity
+
+// keeps what was last submitted so a draw only calls into the sprite engine
+// when the visibility or the position changed
+typedef struct {
+  Sprite* sprite;
+  V2s16 position;  // last submitted, pixels
+  bool visible;    // last submitted
+} EnemySprite;
+
+// life-cycle
+
+// starts hidden, visibility is driven by the culling in the enemy's draw,
+// FALSE when the sprite engine is out of sprites
+bool setUpEnemySprite(EnemySprite* _sprite, const SpriteDefinition* _definition,
+                      u16 _palette, V2s16 _position);
+
+void drawEnemySprite(EnemySprite* _sprite, bool _visible, V2s16 _position);
+
+void releaseEnemySprite(EnemySprite* _sprite);
+
+void releaseEnemySprites(EnemySprite _sprites[], u8 _count);
+
+#endif  // __QUANTUM_BURST_ACTORS_ENEMIES_ENEMY_H__
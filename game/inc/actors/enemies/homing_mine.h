@@ -31,6 +31,6 @@
 
 void initHomingMine();
 
-void createHomingMine(u16 _palette, V2f32 _position, Actor* _player);
+void createHomingMine(u16 _palette, V2f16 _position, ActorHandle _player);
 
 #endif  // __QUANTUM_BURST_ACTORS_ENEMIES_HOMING_MINE_H__
@@ -26,11 +26,44 @@
 #include <genesis.h>
 
 #include "actor.h"
+#include "actors/enemies/enemy.h"
+#include "hitbox.h"
+#include "path.h"
+
+// entity
+
+// what every single mine carries whatever drives its movement
+typedef struct {
+  EnemySprite sprite;
+  ActorHandle player;
+  bool exploded;
+} MineBody;
 
 // life-cycle
 
 void initMine();
 
-void createMine(u16 _palette, V2f32 _position, Actor* _player);
+void createMine(u16 _palette, V2f16 _position, const Path _paths[],
+                ActorHandle _player);
+
+// FALSE when out of sprites, done before the actor exists so a failed mine
+// is never spawned at all
+bool setUpMineBody(MineBody* _body, V2f16 _position, u16 _palette,
+                   ActorHandle _player);
+
+void drawMineBody(MineBody* _body, const Actor* _actor);
+
+void releaseMineBody(MineBody* _body);
+
+// actions
+
+// explodes on the player and flags the actor for clean up
+void collideMineBody(MineBody* _body, Actor* _actor, V2f16 _position);
+
+// properties
+
+V2s16 getMineSpriteOffset();
+
+const Hitbox* getMineHitbox();
 
 #endif  // __QUANTUM_BURST_ACTORS_ENEMIES_MINE_H__
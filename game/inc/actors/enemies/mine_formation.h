@@ -0,0 +1,46 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __QUANTUM_BURST_ACTORS_ENEMIES_MINE_FORMATION_H__
+#define __QUANTUM_BURST_ACTORS_ENEMIES_MINE_FORMATION_H__
+
+#include <genesis.h>
+
+#include "actor.h"
+#include "path.h"
+
+// entity
+
+typedef enum {
+  MINE_FORMATION_SHAPE_LINE,
+  MINE_FORMATION_SHAPE_COLUMN,
+  MINE_FORMATION_SHAPE_VEE,
+  MINE_FORMATION_SHAPE_COUNT
+} MineFormationShape;
+
+// life-cycle
+
+void createMineFormation(u16 _palette, V2f16 _position,
+                         MineFormationShape _shape, const Path _paths[],
+                         ActorHandle _player);
+
+#endif  // __QUANTUM_BURST_ACTORS_ENEMIES_MINE_FORMATION_H__
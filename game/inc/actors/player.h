@@ -26,12 +26,13 @@
 #include <genesis.h>
 
 #include "actor.h"
+#include "hitbox.h"
 
 // life-cycle
 
 void initPlayer();
 
-Actor* createPlayer(u16 _palette, V2f32 _position);
+Actor* createPlayer(u16 _palette, V2f16 _position);
 
 // actions
 
@@ -41,6 +42,10 @@ void doPlayerHit(Actor* _actor);
 
 u8 getPlayerRadius(const Actor* _actor);
 
+const Hitbox* getPlayerHitbox(const Actor* _actor);
+
+u8 getPlayerHealth(const Actor* _actor);
+
 bool isPlayerDead(const Actor* _actor);
 
 #endif  // __QUANTUM_BURST_ACTORS_PLAYER_H__
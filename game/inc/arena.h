@@ -0,0 +1,68 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __QUANTUM_BURST_ARENA_H__
+#define __QUANTUM_BURST_ARENA_H__
+
+#include <genesis.h>
+
+// entity
+
+typedef enum {
+  ARENA_TAG_ACTORS,  // actors and managed actor nodes
+  ARENA_TAG_PLAYER,
+  ARENA_TAG_ENEMIES,
+  ARENA_TAG_COUNT
+} ArenaTag;
+
+// life-cycle
+
+void initArena();
+
+void setUpArena();
+
+void tearDownArena();
+
+// actions
+
+void* allocateArena(u16 _size, ArenaTag _tag);
+
+// hands a fixed size record back, the next allocation of that size reuses it
+void freeArena(void* _memory, u16 _size, ArenaTag _tag);
+
+// properties
+
+u16 getArenaUsed();
+
+u16 getArenaFree();
+
+// bytes waiting on the free lists for a record of their size
+u16 getArenaRecycled();
+
+// bytes bumped past since the set up, live or recycled
+u16 getArenaReserved();
+
+// debug
+
+void showArenaUsage(u16 _x, u16 _y);
+
+#endif  // __QUANTUM_BURST_ARENA_H__
@@ -29,8 +29,16 @@
 
 typedef V2f32 (*CameraPositionCallback)();
 
+typedef struct {
+  V2s32 minimum;       // pixels, top left of the screen in world space
+  V2s32 maximum;       // pixels, bottom right of the screen in world space
+  V2s16 localMinimum;  // pixels, minimum relative to the stage chunk origin
+  V2s16 localMaximum;  // pixels, maximum relative to the stage chunk origin
+} CameraView;
+
 typedef struct {
   V2f32 position;
+  CameraView view;
   CameraPositionCallback positionCallback;
 } Camera;
 
@@ -39,9 +47,9 @@ typedef struct {
 void initCamera();
 
 void setUpCamera(Camera* _camera, CameraPositionCallback _positionCallback,
-                 bool _evaluateCallback);
+                 bool _evaluateCallback, V2s32 _origin);
 
-void updateCamera(Camera* _camera);
+void updateCamera(Camera* _camera, V2s32 _origin);
 
 void tearDownCamera(Camera* _camera);
 
@@ -49,4 +57,6 @@ void tearDownCamera(Camera* _camera);
 
 V2s32 getCameraPositionRounded(const Camera* _camera);
 
+const CameraView* getCameraView(const Camera* _camera);
+
 #endif  // __QUANTUM_BURST_CAMERA_H__
@@ -47,6 +47,8 @@ void processGameLoad();
 
 void processGamePlay();
 
+bool isGamePlayPaused();
+
 void processGameCredits();
 
 #endif  // __QUANTUM_BURST_GAME_H__
@@ -0,0 +1,56 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __QUANTUM_BURST_GOVERNOR_H__
+#define __QUANTUM_BURST_GOVERNOR_H__
+
+#include <genesis.h>
+
+// entity
+
+typedef enum {
+  GOVERNOR_LEVEL_FULL,         // everything enabled
+  GOVERNOR_LEVEL_REDUCED,      // fewer particles, AI decisions at half rate
+  GOVERNOR_LEVEL_NO_BANKING,   // banking animation dropped
+  GOVERNOR_LEVEL_NO_BLINKING,  // damage blink dropped
+  GOVERNOR_LEVEL_COUNT
+} GovernorLevel;
+
+// life-cycle
+
+void initGovernor();
+
+void setUpGovernor();
+
+void updateGovernor();
+
+// properties
+
+GovernorLevel getGovernorLevel();
+
+bool isGovernorLevelAtLeast(GovernorLevel _level);
+
+// debug
+
+void showGovernorLevel(u16 _x, u16 _y);
+
+#endif  // __QUANTUM_BURST_GOVERNOR_H__
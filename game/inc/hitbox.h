@@ -0,0 +1,66 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __QUANTUM_BURST_HITBOX_H__
+#define __QUANTUM_BURST_HITBOX_H__
+
+#include <genesis.h>
+
+#include "tile_mask.h"
+
+// constants
+
+#define HITBOX_BOXES_MAX 3  // must match BOXES_MAX in tools/hitbox.py
+
+// entity
+
+typedef struct {
+  s8 x;       // pixels, relative to the actor position
+  s8 y;       // pixels, relative to the actor position
+  u8 width;   // pixels
+  u8 height;  // pixels
+} HitboxBox;
+
+typedef struct {
+  u8 count;
+  u8 radius;  // pixels, furthest any box reaches from the actor position
+  HitboxBox boxes[HITBOX_BOXES_MAX];
+} Hitbox;
+
+typedef struct {
+  u16 columns;             // frames per animation
+  u16 count;               // frames per orientation
+  const Hitbox* hitboxes;  // upright frames followed by flipped frames
+} HitboxSheet;
+
+// utilities
+
+const Hitbox* getHitbox(const HitboxSheet* _sheet, u8 _animation, u8 _frame,
+                        bool _flipped);
+
+bool isHitboxOverlapping(const Hitbox* _hitbox1, V2f16 _position1,
+                         const Hitbox* _hitbox2, V2f16 _position2);
+
+bool isHitboxOverlappingTileMask(const Hitbox* _hitbox, V2f16 _position,
+                                 const TileMask* _mask, V2s16 _maskPosition);
+
+#endif  // __QUANTUM_BURST_HITBOX_H__
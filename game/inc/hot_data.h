@@ -0,0 +1,78 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __QUANTUM_BURST_HOT_DATA_H__
+#define __QUANTUM_BURST_HOT_DATA_H__
+
+#include <genesis.h>
+
+#include "stage.h"
+
+// Variables touched every frame live in a small block at the very top of work
+// RAM, above the stack, where the 68000 can reach them with 16-bit absolute
+// short addressing. GCC only picks that mode for addresses it can see while
+// compiling, a symbol the linker places is always reached with a 32-bit
+// address wherever it ends up, so the hot variables are the members of one
+// struct at a fixed address rather than ordinary globals. tools/hot_data.py
+// reports the layout and checks the linked ROM keeps everything else out of
+// the block.
+
+// constants
+
+#define HOT_DATA_START 0x00FFFF00  // the initial stack pointer sits just below
+#define HOT_DATA_SIZE 256          // bytes
+
+// entity
+
+struct _ManagedActor;
+
+// the order is the layout of the block
+typedef struct {
+  struct _ManagedActor* firstManagedActor;
+  struct _ManagedActor* lastManagedActor;
+  V2f32 cameraOffset;
+  u32 particleAlive;    // one bit per particle slot
+  f16 playerVelocity;   // pixels/frame
+  f16 homingMineSpeed;  // pixels/frame
+  u8 frameRateIndex;
+  u8 aiBudget;          // decisions left this frame
+  Stage stage;          // the one being played
+} HotData;
+
+// global properties
+
+#ifdef __m68k__
+// sign extended so the address fits in 16 bits, the 68000 only decodes the
+// low 24 of them anyway
+#define HOT_DATA (*(HotData*)(HOT_DATA_START | 0xFF000000))
+#else
+// host builds of game modules for tools/bench keep the block in a global
+extern HotData g_hotData;
+
+#define HOT_DATA g_hotData
+#endif
+
+// life-cycle
+
+void initHotData(bool _hardReset);
+
+#endif  // __QUANTUM_BURST_HOT_DATA_H__
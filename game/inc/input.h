@@ -0,0 +1,58 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __QUANTUM_BURST_INPUT_H__
+#define __QUANTUM_BURST_INPUT_H__
+
+#include <genesis.h>
+
+#include "actor.h"
+#include "build_config.h"
+#include "stage.h"
+
+// constants
+
+// AUTOPLAY swaps the first pad for a bot that plays through menu, stage and
+// credits on its own for soak testing, otherwise this reads the pad directly
+#ifdef AUTOPLAY
+#define readInput(_player, _stage) (readAutoplayInput((_player), (_stage)))
+#define setInputEventHandler(_handler) (setAutoplayEventHandler(_handler))
+#else
+#define readInput(_player, _stage) (JOY_readJoypad(JOY_1))
+#define setInputEventHandler(_handler) (JOY_setEventHandler(_handler))
+#endif
+
+// life-cycle
+
+void initInput();
+
+// autoplay
+
+#ifdef AUTOPLAY
+// held buttons for the player, firing all the time and steering away from
+// the nearest enemy ahead
+u16 readAutoplayInput(const Actor* _player, const Stage* _stage);
+
+void setAutoplayEventHandler(JoyEventCallback* _handler);
+#endif
+
+#endif  // __QUANTUM_BURST_INPUT_H__
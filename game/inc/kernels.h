@@ -0,0 +1,72 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __QUANTUM_BURST_KERNELS_H__
+#define __QUANTUM_BURST_KERNELS_H__
+
+#include <genesis.h>
+
+#include "actor.h"
+#include "build_config.h"
+#include "camera.h"
+
+// constants
+
+// ASM_KERNELS swaps in the hand written 68000 versions from kernels_asm.s,
+// the C versions stay around as the reference they are checked against
+#ifdef ASM_KERNELS
+#define projectActorList projectActorListAsm
+#define getFastDistance getFastDistanceAsm
+#else
+#define projectActorList projectActorListC
+#define getFastDistance getFastDistanceC
+#endif
+
+// KERNELS_TEST has a DEBUG build check both versions against each other and
+// time them at boot, it's left out otherwise as it holds up every start
+#if defined(DEBUG) && defined(KERNELS_TEST)
+#define KERNELS_TEST_ENABLED
+#endif
+
+// life-cycle
+
+void initKernels();
+
+// actions
+
+// projects every actor of a list linked through a next pointer stored
+// _nextOffset bytes into each actor, same results as projectActor
+void projectActorListC(Actor* _first, u16 _nextOffset,
+                       const CameraView* _view);
+
+void projectActorListAsm(Actor* _first, u16 _nextOffset,
+                         const CameraView* _view);
+
+// utilities
+
+// 123/128 of the longer side plus 51/128 of the shorter one, within a few
+// percent of the real length, SGDK already has the C version
+#define getFastDistanceC getApproximatedDistance
+
+u32 getFastDistanceAsm(s32 _deltaX, s32 _deltaY);
+
+#endif  // __QUANTUM_BURST_KERNELS_H__
@@ -33,10 +33,11 @@
 
 void initManagedActors();
 
-void createManagedActor(V2f32 _position, void* _data,
-                        ActorUpdateCallback _updateCallback,
-                        ActorDrawCallback _drawCallback,
-                        ActorDestroyCallback _destroyCallback);
+// NULL when the arena is full or every handle is taken
+Actor* createManagedActor(V2f16 _position, void* _data,
+                          ActorUpdateCallback _updateCallback,
+                          ActorDrawCallback _drawCallback,
+                          ActorDestroyCallback _destroyCallback);
 
 void updateManagedActors(const Stage* _stage);
 
@@ -48,4 +49,9 @@ void destroyManagedActors();
 
 void setManagedActorCleanUp(Actor* _actor);
 
+// list order, actors waiting to be cleaned up included
+Actor* getFirstManagedActor();
+
+Actor* getNextManagedActor(const Actor* _actor);
+
 #endif  // __QUANTUM_BURST_MANAGED_ACTOR_H__
@@ -0,0 +1,74 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __QUANTUM_BURST_PARTICLES_H__
+#define __QUANTUM_BURST_PARTICLES_H__
+
+#include <genesis.h>
+
+#include "camera.h"
+#include "stage.h"
+
+// entity
+
+typedef enum {
+  PARTICLE_EFFECT_SPARK,  // quick flash that burns out
+  PARTICLE_EFFECT_EMBER,  // slower glow left behind
+  PARTICLE_EFFECT_COUNT
+} ParticleEffect;
+
+typedef enum {
+  PARTICLE_PRIORITY_LOW,  // first to go when the pool is full
+  PARTICLE_PRIORITY_NORMAL,
+  PARTICLE_PRIORITY_HIGH
+} ParticlePriority;
+
+// life-cycle
+
+void initParticles();
+
+u16 setUpParticles(u16 _palette, u16 _tileIndex);
+
+void updateParticles(const Stage* _stage);
+
+// once per frame, catch up ticks share the budget
+void resetParticleSpawnBudget();
+
+void drawParticles(const Camera* _camera);
+
+void tearDownParticles();
+
+// actions
+
+bool spawnParticle(ParticleEffect _effect, V2f16 _position, V2f16 _velocity,
+                   ParticlePriority _priority);
+
+void spawnExplosion(V2f16 _position, ParticlePriority _priority);
+
+// properties
+
+void setParticleTilesAllowed(bool _allowed);
+
+// rows above this are under the window, anything there stays a sprite
+void setParticleTilesFirstRow(u16 _row);
+
+#endif  // __QUANTUM_BURST_PARTICLES_H__
@@ -0,0 +1,49 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __QUANTUM_BURST_PATH_H__
+#define __QUANTUM_BURST_PATH_H__
+
+#include <genesis.h>
+
+// entity
+
+typedef struct {
+  const V2f16* deltas;  // pixels/frame
+  u16 length;           // frames
+  bool loop;
+} Path;
+
+typedef struct {
+  const Path* path;
+  u16 index;  // frames
+} PathFollower;
+
+// life-cycle
+
+void setUpPathFollower(PathFollower* _follower, const Path _paths[]);
+
+// actions
+
+bool advancePath(PathFollower* _follower, V2f16* _position);
+
+#endif  // __QUANTUM_BURST_PATH_H__
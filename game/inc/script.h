@@ -0,0 +1,80 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __QUANTUM_BURST_SCRIPT_H__
+#define __QUANTUM_BURST_SCRIPT_H__
+
+#include <genesis.h>
+
+#include "actor.h"
+#include "ai_scheduler.h"
+#include "path.h"
+
+// constants
+
+// opcodes and patterns must match tools/script.py
+#define SCRIPT_OP_DESPAWN 0x00  // -
+#define SCRIPT_OP_WAIT 0x01     // u16 frames
+#define SCRIPT_OP_MOVE 0x02     // f16 x, f16 y, u16 frames
+#define SCRIPT_OP_PATH 0x03     // u8 path
+#define SCRIPT_OP_HOME 0x04     // f16 speed, u16 frames
+#define SCRIPT_OP_FIRE 0x05     // u8 pattern
+#define SCRIPT_OP_JUMP 0x06     // u16 offset
+#define SCRIPT_PATTERN_AIMED 0
+#define SCRIPT_PATTERN_SPREAD 1
+#define SCRIPT_PATTERN_RING 2
+
+// entity
+
+typedef enum {
+  SCRIPT_RESULT_RUNNING,
+  SCRIPT_RESULT_DESPAWN
+} ScriptResult;
+
+typedef struct {
+  const u8* code;
+  u16 length;  // bytes
+} Script;
+
+typedef void (*ScriptFireCallback)(Actor* _actor, u8 _pattern);
+
+typedef struct {
+  const Script* script;
+  u16 counter;        // bytes, next instruction
+  u8 operation;       // instruction in progress
+  u16 timer;          // frames left on the instruction in progress
+  V2f16 velocity;     // pixels/frame
+  f16 speed;          // pixels/frame, while homing
+  PathFollower path;  // while following a path
+  AISchedule schedule;
+} ScriptRunner;
+
+// life-cycle
+
+void setUpScriptRunner(ScriptRunner* _runner, const Script _scripts[]);
+
+// actions
+
+ScriptResult runScript(ScriptRunner* _runner, Actor* _actor,
+                       ActorHandle _target, ScriptFireCallback _fire);
+
+#endif  // __QUANTUM_BURST_SCRIPT_H__
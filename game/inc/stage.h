@@ -26,6 +26,7 @@
 #include <genesis.h>
 
 #include "camera.h"
+#include "tile_mask.h"
 
 // entity
 
@@ -37,6 +38,13 @@ typedef struct {
   f32 minimumX;
   f32 maximumX;
   f32 speed;
+  V2s32 origin;        // pixels, chunk origin actor positions are relative to
+  s16 originShift;     // pixels, how far the origin moved this frame
+  V2f16 localMinimum;  // pixels, playable area relative to the origin
+  V2f16 localMaximum;  // pixels, playable area relative to the origin
+  f16 scroll;          // pixels, how far the playable area moved this frame
+  TileMask collision;
+  u16 tileIndex;       // first VRAM tile free after the stage tiles
 } Stage;
 
 // life-cycle
@@ -51,4 +59,15 @@ void drawStage(const Stage* _stage, const Camera* _camera);
 
 void tearDownStage(Stage* _stage);
 
+// utilities
+
+V2f16 getStageLocalPosition(const Stage* _stage, V2f32 _position);
+
+V2f32 getStageWorldPosition(const Stage* _stage, V2f16 _position);
+
+bool isStageSolid(const Stage* _stage, V2f16 _position);
+
+V2f16 resolveStageMovement(const Stage* _stage, V2f16 _from, V2f16 _to,
+                           V2s16 _extent);
+
 #endif  // __QUANTUM_BURST_STAGE_H__
@@ -0,0 +1,46 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __QUANTUM_BURST_TILE_MASK_H__
+#define __QUANTUM_BURST_TILE_MASK_H__
+
+#include <genesis.h>
+
+// entity
+
+typedef struct {
+  const u8* bits;  // one bit per tile, rows padded to whole bytes
+  u16 columns;     // tiles
+  u16 rows;        // tiles
+  u16 stride;      // bytes
+} TileMask;
+
+// life-cycle
+
+void setUpTileMask(TileMask* _mask, const u8* _data);
+
+// utilities
+
+bool isTileMaskSolid(const TileMask* _mask, s16 _left, s16 _top, s16 _right,
+                     s16 _bottom);
+
+#endif  // __QUANTUM_BURST_TILE_MASK_H__
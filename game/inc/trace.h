@@ -0,0 +1,84 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __QUANTUM_BURST_TRACE_H__
+#define __QUANTUM_BURST_TRACE_H__
+
+#include <genesis.h>
+
+#include "build_config.h"
+
+// constants
+
+#if defined(DEBUG) || defined(TRACE)
+#define TRACE_ENABLED
+#endif
+
+#define TRACE_MAGIC 0x51425452  // "QBTR", lets tools/trace.py find the ring
+#define TRACE_RECORDS 256       // must be a power of two
+
+// entity
+
+// the comments are the format tools/trace.py prints each event with, the
+// two arguments filling in the %u in order
+typedef enum {
+  TRACE_EVENT_LAG,               // lag frame, %u ticks
+  TRACE_EVENT_GOVERNOR,          // governor level %u -> %u
+  TRACE_EVENT_PLAYER_HIT,        // player hit, %u health left
+  TRACE_EVENT_PARTICLE_STOLEN,   // particle slot %u stolen for priority %u
+  TRACE_EVENT_PARTICLE_DROPPED,  // particle effect %u dropped, priority %u
+  TRACE_EVENT_SOUND_DROPPED,     // sound effect %u dropped, queue full
+  TRACE_EVENT_COUNT
+} TraceEvent;
+
+typedef struct {
+  u16 frame;  // low bits of vtimer
+  u16 event;
+  u16 argument1;
+  u16 argument2;
+} TraceRecord;
+
+typedef struct {
+  u32 magic;
+  u16 head;   // next record to write
+  u16 count;  // records written, stops at TRACE_RECORDS
+  TraceRecord records[TRACE_RECORDS];
+} TraceBuffer;
+
+// instrumentation only costs anything when tracing is compiled in, a record
+// is four word writes with no formatting at all
+#ifdef TRACE_ENABLED
+#define trace(_event, _argument1, _argument2)                                  \
+  (writeTrace((_event), (_argument1), (_argument2)))
+#else
+#define trace(_event, _argument1, _argument2)
+#endif
+
+// life-cycle
+
+void initTrace();
+
+// actions
+
+void writeTrace(TraceEvent _event, u16 _argument1, u16 _argument2);
+
+#endif  // __QUANTUM_BURST_TRACE_H__
@@ -25,6 +25,23 @@
 
 #include <genesis.h>
 
+// constants
+
+#define PAL_FRAME_RATE 50
+#define NTSC_FRAME_RATE 60
+#define FRAME_RATE_INDEX_NTSC 0
+#define FRAME_RATE_INDEX_PAL 1
+
+// per frame values for tables indexed with getFrameRateIndex(), these only
+// use constants so the compiler works them out and nothing runs at runtime
+
+#define NTSC_PER_FRAME(_perSecond) ((_perSecond) / (double)NTSC_FRAME_RATE)
+#define PAL_PER_FRAME(_perSecond) ((_perSecond) / (double)PAL_FRAME_RATE)
+#define NTSC_SECONDS_TO_FRAMES(_seconds)                                       \
+  ((u16)((_seconds) * NTSC_FRAME_RATE + 0.5))
+#define PAL_SECONDS_TO_FRAMES(_seconds)                                        \
+  ((u16)((_seconds) * PAL_FRAME_RATE + 0.5))
+
 void initUtilities();
 
 void showText(char _text[], u8 _column);
@@ -33,8 +50,14 @@ void clearText(u8 _column);
 
 u8 getFrameRate();
 
+u8 getFrameRateIndex();
+
 f32 getFrameDeltaTime();
 
 u16 secondsToFrames(f16 _seconds);
 
+void resetFrameTicks();
+
+u8 getFrameTicks();
+
 #endif  // __QUANTUM_BURST_UTILITIES_H__
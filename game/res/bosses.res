@@ -0,0 +1,2 @@
+IMAGE k_boss1Image "bosses/boss-1.png" BEST
+BIN k_boss1Collision "bosses/boss-1-collision.bin"
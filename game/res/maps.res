@@ -1,3 +1,4 @@
 PALETTE k_stage1Palette "maps/stage-1.png"
 TILESET k_stage1TileSet "maps/stage-1.png" BEST ALL
 MAP k_stage1Map "maps/stage-1.png" k_stage1TileSet BEST
+BIN k_stage1Collision "maps/stage-1-collision.bin"
@@ -0,0 +1,2 @@
+WAV k_explosionSound "sounds/explosion.wav" XGM2
+WAV k_hitSound "sounds/hit.wav" XGM2
@@ -2,3 +2,5 @@ PALETTE k_primarySpritePalette "sprites/ship.png"
 SPRITE k_titleSprite "sprites/title.png" 25 6 FAST
 SPRITE k_shipSprite "sprites/ship.png" 8 5 FAST
 SPRITE k_mineSprite "sprites/mine.png" 2 2 FAST
+SPRITE k_sparkSprite "sprites/spark.png" 1 1 FAST
+TILESET k_sparkTileSet "sprites/spark.png" NONE NONE
@@ -23,48 +23,163 @@
 #include <genesis.h>
 
 #include "actor.h"
+#include "arena.h"
 #include "assert.h"
+#include "kernels.h"
+
+// constants
+
+#define ACTOR_DISTANCE_MAX (FIX16(511))  // pixels
+#define ACTOR_BEHIND_STAGE_DISTANCE 64   // pixels
+#define ACTOR_HANDLE_SLOT_MASK 0xFF
+#define ACTOR_HANDLE_GENERATION_SHIFT 8
+
+// global properties
+
+// actors are only ever reached through the table so moving one just means
+// pointing its slot somewhere else
+static Actor* g_actorHandleActors[ACTOR_HANDLES_MAX];
+static u8 g_actorHandleGenerations[ACTOR_HANDLES_MAX];  // never 0
+static u8 g_actorHandleFreeSlots[ACTOR_HANDLES_MAX];    // stack
+static u16 g_actorHandleFreeCount;
+
+// private functions
+
+static ActorHandle acquireHandle(Actor* _actor) {
+  // dead actors keep theirs until they're collected, so a scene can run out
+  // while respawning, DEBUG builds stop so it gets noticed
+  assert(g_actorHandleFreeCount > 0, "Out of actor handles");
+
+  if (g_actorHandleFreeCount == 0) {
+    return ACTOR_HANDLE_NONE;
+  }
+
+  g_actorHandleFreeCount--;
+
+  const u8 slot = g_actorHandleFreeSlots[g_actorHandleFreeCount];
+
+  g_actorHandleActors[slot] = _actor;
+
+  return (g_actorHandleGenerations[slot] << ACTOR_HANDLE_GENERATION_SHIFT) |
+         slot;
+}
+
+static void releaseHandle(ActorHandle _handle) {
+  const u8 slot = _handle & ACTOR_HANDLE_SLOT_MASK;
+  u8 generation = g_actorHandleGenerations[slot] + 1;
+
+  // generation 0 is kept for ACTOR_HANDLE_NONE
+  if (generation == 0) {
+    generation = 1;
+  }
+
+  g_actorHandleActors[slot] = NULL;
+  g_actorHandleGenerations[slot] = generation;
+  g_actorHandleFreeSlots[g_actorHandleFreeCount] = slot;
+
+  g_actorHandleFreeCount++;
+}
 
 // public functions
 
-Actor* createActor(V2f32 _position, void* _data,
+void initActors() {
+  for (u16 i = 0; i < ACTOR_HANDLES_MAX; i++) {
+    g_actorHandleActors[i] = NULL;
+    g_actorHandleGenerations[i] = 1;
+    g_actorHandleFreeSlots[i] = ACTOR_HANDLES_MAX - 1 - i;
+  }
+
+  g_actorHandleFreeCount = ACTOR_HANDLES_MAX;
+}
+
+Actor* createActor(V2f16 _position, void* _data,
                    ActorUpdateCallback _updateCallback,
                    ActorDrawCallback _drawCallback,
                    ActorDestroyCallback _destroyCallback) {
-  Actor* actor = malloc(sizeof(Actor));
+  Actor* actor = allocateArena(sizeof(Actor), ARENA_TAG_ACTORS);
+
+  if (actor == NULL) {
+    return NULL;
+  }
+
+  if (!setUpActor(actor, _position, _data, _updateCallback, _drawCallback,
+                  _destroyCallback)) {
+    freeArena(actor, sizeof(Actor), ARENA_TAG_ACTORS);
 
-  assert(actor != NULL, "Failed to allocate actor");
-  setUpActor(actor, _position, _data, _updateCallback, _drawCallback,
-             _destroyCallback);
+    return NULL;
+  }
 
   return actor;
 }
 
-void setUpActor(Actor* _actor, V2f32 _position, void* _data,
+bool setUpActor(Actor* _actor, V2f16 _position, void* _data,
                 ActorUpdateCallback _updateCallback,
                 ActorDrawCallback _drawCallback,
                 ActorDestroyCallback _destroyCallback) {
   _actor->position = _position;
+  _actor->extent.x = 0;
+  _actor->extent.y = 0;
+  _actor->screenPosition.x = 0;
+  _actor->screenPosition.y = 0;
+  _actor->onScreen = TRUE;  // forces a draw on the first projection
+  _actor->wasOnScreen = TRUE;
   _actor->data = _data;
   _actor->updateCallback = _updateCallback;
   _actor->drawCallback = _drawCallback;
   _actor->destroyCallback = _destroyCallback;
+  _actor->handle = acquireHandle(_actor);
+
+  return _actor->handle != ACTOR_HANDLE_NONE;
 }
 
 void updateActor(Actor* _actor, const Stage* _stage) {
-  if (_actor == NULL || _actor->updateCallback == NULL || _stage == NULL) {
+  if (_actor == NULL || _stage == NULL) {
+    return;
+  }
+
+  // keep the position relative to the stage chunk origin
+  _actor->position.x = _actor->position.x - FIX16(_stage->originShift);
+
+  if (_actor->updateCallback == NULL) {
     return;
   }
 
   _actor->updateCallback(_actor, _stage);
 }
 
-void drawActor(const Actor* _actor, const Camera* _camera) {
-  if (_actor == NULL || _actor->drawCallback == NULL || _camera == NULL) {
+void projectActor(Actor* _actor, const CameraView* _view) {
+  const s16 x = F16_toRoundedInt(_actor->position.x);
+  const s16 y = F16_toRoundedInt(_actor->position.y);
+  const s16 extentX = _actor->extent.x;
+  const s16 extentY = _actor->extent.y;
+  const V2s16 minimum = _view->localMinimum;
+  const V2s16 maximum = _view->localMaximum;
+
+  _actor->wasOnScreen = _actor->onScreen;
+
+  if (x + extentX <= minimum.x || x - extentX >= maximum.x ||
+      y + extentY <= minimum.y || y - extentY >= maximum.y) {
+    _actor->onScreen = FALSE;
+
+    return;
+  }
+
+  _actor->onScreen = TRUE;
+  _actor->screenPosition.x = x - extentX - minimum.x;
+  _actor->screenPosition.y = y - extentY - minimum.y;
+}
+
+void drawActor(const Actor* _actor) {
+  if (_actor == NULL || _actor->drawCallback == NULL) {
     return;
   }
 
-  _actor->drawCallback(_actor, _camera);
+  // off screen actors only get drawn on the frame they leave so they can hide
+  if (!_actor->onScreen && !_actor->wasOnScreen) {
+    return;
+  }
+
+  _actor->drawCallback(_actor);
 }
 
 void tearDownActor(Actor* _actor) {
@@ -72,57 +187,107 @@ void tearDownActor(Actor* _actor) {
     _actor->destroyCallback(_actor);
   }
 
+  releaseHandle(_actor->handle);
+
   _actor->data = NULL;
+  _actor->handle = ACTOR_HANDLE_NONE;
 }
 
 void destroyActor(Actor* _actor) {
   tearDownActor(_actor);
-  free(_actor);
+  freeArena(_actor, sizeof(Actor), ARENA_TAG_ACTORS);
 }
 
-V2f32 getActorPosition(const Actor* _actor) {
+V2f16 getActorPosition(const Actor* _actor) {
   return _actor->position;
 }
 
-f32 getActorPositionX(const Actor* _actor) {
-  const V2f32 position = getActorPosition(_actor);
+f16 getActorPositionX(const Actor* _actor) {
+  const V2f16 position = getActorPosition(_actor);
 
   return position.x;
 }
 
-f32 getActorPositionY(const Actor* _actor) {
-  const V2f32 position = getActorPosition(_actor);
+f16 getActorPositionY(const Actor* _actor) {
+  const V2f16 position = getActorPosition(_actor);
 
   return position.y;
 }
 
-void setActorPosition(Actor* _actor, V2f32 _position) {
+void setActorPosition(Actor* _actor, V2f16 _position) {
   _actor->position = _position;
 }
 
+V2s16 getActorExtent(const Actor* _actor) {
+  return _actor->extent;
+}
+
+void setActorExtent(Actor* _actor, V2s16 _extent) {
+  _actor->extent = _extent;
+}
+
+V2s16 getActorScreenPosition(const Actor* _actor) {
+  return _actor->screenPosition;
+}
+
+bool isActorOnScreen(const Actor* _actor) {
+  return _actor->onScreen;
+}
+
 void* getActorData(const Actor* _actor) {
   return _actor->data;
 }
 
-V2f32 getDirectionTowardsActor(const Actor* _actor, const Actor* _target) {
-  const V2f32 position1 = getActorPosition(_actor);
-  const V2f32 position2 = getActorPosition(_target);
-  const s32 deltaX = (s32)(position1.x - position2.x);
-  const s32 deltaY = (s32)(position1.y - position2.y);
-  const f32 magnitude = (f32)getApproximatedDistance(deltaX, deltaY);
-  const V2f32 direction = {
-    F32_div((f32)deltaX, magnitude),  // x
-    F32_div((f32)deltaY, magnitude)   // y
+ActorHandle getActorHandle(const Actor* _actor) {
+  return _actor->handle;
+}
+
+Actor* resolveActorHandle(ActorHandle _handle) {
+  const u8 slot = _handle & ACTOR_HANDLE_SLOT_MASK;
+  const u8 generation = _handle >> ACTOR_HANDLE_GENERATION_SHIFT;
+
+  // a reused slot has moved on to a newer generation so stale handles miss
+#if ACTOR_HANDLES_MAX < 256
+  if (slot >= ACTOR_HANDLES_MAX) {
+    return NULL;
+  }
+#endif
+
+  if (g_actorHandleGenerations[slot] != generation) {
+    return NULL;
+  }
+
+  return g_actorHandleActors[slot];
+}
+
+V2f16 getDirectionTowardsActor(const Actor* _actor, const Actor* _target) {
+  const V2f16 position1 = getActorPosition(_actor);
+  const V2f16 position2 = getActorPosition(_target);
+  const s32 deltaX = (s32)position1.x - position2.x;  // may not fit in fix16
+  const s32 deltaY = (s32)position1.y - position2.y;  // may not fit in fix16
+  const s32 magnitude = (s32)getFastDistance(deltaX, deltaY);
+  const V2f16 direction = {
+    (deltaX << FIX16_FRAC_BITS) / magnitude,  // x
+    (deltaY << FIX16_FRAC_BITS) / magnitude   // y
   };
 
   return direction;
 }
 
-f32 getDistanceBetweenActors(const Actor* _actor1, const Actor* _actor2) {
-  const V2f32 position1 = getActorPosition(_actor1);
-  const V2f32 position2 = getActorPosition(_actor2);
-  const s32 deltaX = (s32)(position1.x - position2.x);
-  const s32 deltaY = (s32)(position1.y - position2.y);
+f16 getDistanceBetweenActors(const Actor* _actor1, const Actor* _actor2) {
+  const V2f16 position1 = getActorPosition(_actor1);
+  const V2f16 position2 = getActorPosition(_actor2);
+  const s32 deltaX = (s32)position1.x - position2.x;  // may not fit in fix16
+  const s32 deltaY = (s32)position1.y - position2.y;  // may not fit in fix16
+  const u32 magnitude = getFastDistance(deltaX, deltaY);
+
+  // saturate instead of wrapping, anything this far away is out of reach
+  return min(magnitude, ACTOR_DISTANCE_MAX);
+}
+
+bool isActorBehindStage(const Actor* _actor, const Stage* _stage) {
+  const f16 limitX =
+    _stage->localMinimum.x - FIX16(ACTOR_BEHIND_STAGE_DISTANCE);
 
-  return (f32)getApproximatedDistance(deltaX, deltaY);
+  return _actor->position.x < limitX;
 }
@@ -0,0 +1,311 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <genesis.h>
+
+#include "actor.h"
+#include "actors/enemies/boss.h"
+#include "actors/enemies/enemy.h"
+#include "actors/player.h"
+#include "arena.h"
+#include "assert.h"
+#include "bosses.h"
+#include "hitbox.h"
+#include "hitboxes.h"
+#include "managed_actor.h"
+#include "particles.h"
+#include "path.h"
+#include "paths.h"
+#include "sprites.h"
+#include "stage.h"
+#include "tile_mask.h"
+#include "utilities.h"
+
+// constants
+
+#define BOSS_PARTS_MAX 2
+#define BOSS_PLANE_X 384        // pixels, right of anything else on BG_A
+#define BOSS_SCREEN_MARGIN 16   // pixels, gap to the right edge when holding
+#define BOSS_ENTRY_VELOCITY 60  // pixels/second, relative to the screen
+#define BOSS_EXIT_VELOCITY 90   // pixels/second, relative to the screen
+#define BOSS_HOLD_DURATION 20   // seconds
+
+static const f16 k_bossEntrySpeeds[] = {
+  FIX16(NTSC_PER_FRAME(BOSS_ENTRY_VELOCITY)),  // ntsc
+  FIX16(PAL_PER_FRAME(BOSS_ENTRY_VELOCITY))    // pal
+};
+static const f16 k_bossExitSpeeds[] = {
+  FIX16(NTSC_PER_FRAME(BOSS_EXIT_VELOCITY)),  // ntsc
+  FIX16(PAL_PER_FRAME(BOSS_EXIT_VELOCITY))    // pal
+};
+static const u16 k_bossHoldDurations[] = {
+  NTSC_SECONDS_TO_FRAMES(BOSS_HOLD_DURATION),  // ntsc
+  PAL_SECONDS_TO_FRAMES(BOSS_HOLD_DURATION)    // pal
+};
+
+// pixels, relative to the boss position
+static const V2s16 k_bossPartOffsets[] = {{-24, -28}, {-24, 28}};
+
+// global properties
+
+static V2s16 g_bossExtent;      // pixels
+static V2s16 g_bossPartOffset;  // pixels
+static const Hitbox* g_bossPartHitbox;
+static TileMask g_bossMask;
+static f16 g_bossEntrySpeed;    // pixels/frame
+static f16 g_bossExitSpeed;     // pixels/frame
+static u16 g_bossHoldDuration;  // frames
+static bool g_bossActive;
+
+typedef enum {
+  BOSS_STATE_ENTERING,
+  BOSS_STATE_HOLDING,
+  BOSS_STATE_LEAVING
+} BossState;
+
+typedef struct {
+  EnemySprite parts[BOSS_PARTS_MAX];
+  V2s16 scroll;  // last submitted, pixels
+  BossState state;
+  u16 timer;  // frames
+  PathFollower path;
+  ActorHandle player;
+} BossData;
+
+// private functions
+
+static V2f16 move(BossData* _data, V2f16 _position, const Stage* _stage) {
+  V2f16 position = _position;
+
+  switch (_data->state) {
+    case BOSS_STATE_ENTERING: {
+      const f16 holdX = _stage->localMaximum.x -
+                        FIX16(g_bossExtent.x + BOSS_SCREEN_MARGIN);
+
+      // waits off screen until the stage brings it into view, then slides in
+      if (position.x - FIX16(g_bossExtent.x) < _stage->localMaximum.x) {
+        position.x += _stage->scroll - g_bossEntrySpeed;
+      }
+
+      if (position.x <= holdX) {
+        position.x = holdX;
+        _data->state = BOSS_STATE_HOLDING;
+        _data->timer = g_bossHoldDuration;
+      }
+
+      break;
+    }
+
+    case BOSS_STATE_HOLDING:
+      position.x += _stage->scroll;
+
+      advancePath(&_data->path, &position);
+
+      _data->timer--;
+
+      if (_data->timer == 0) {
+        _data->state = BOSS_STATE_LEAVING;
+      }
+
+      break;
+
+    case BOSS_STATE_LEAVING:
+      // the stage may have stopped scrolling by now so it has to fly off on
+      // its own, back out the way it came in
+      position.x += _stage->scroll + g_bossExitSpeed;
+
+      break;
+  }
+
+  return position;
+}
+
+static void update(Actor* _actor, const Stage* _stage) {
+  BossData* data = (BossData*)getActorData(_actor);
+  const V2f16 position = move(data, getActorPosition(_actor), _stage);
+
+  setActorPosition(_actor, position);
+
+  if (data->state == BOSS_STATE_LEAVING &&
+      position.x - FIX16(g_bossExtent.x) >= _stage->localMaximum.x) {
+    setManagedActorCleanUp(_actor);
+
+    return;
+  }
+
+  Actor* player = resolveActorHandle(data->player);
+
+  if (player == NULL) {
+    return;
+  }
+
+  const V2f16 playerPosition = getActorPosition(player);
+  const Hitbox* playerHitbox = getPlayerHitbox(player);
+  const V2s16 maskPosition = {
+    F16_toInt(position.x) - g_bossExtent.x,  // x
+    F16_toInt(position.y) - g_bossExtent.y   // y
+  };
+
+  // the body is a tile map so it collides through its tile mask
+  bool hit = isHitboxOverlappingTileMask(playerHitbox, playerPosition,
+                                         &g_bossMask, maskPosition);
+
+  for (u8 i = 0; i < BOSS_PARTS_MAX && !hit; i++) {
+    const V2f16 partPosition = {
+      position.x + FIX16(k_bossPartOffsets[i].x),  // x
+      position.y + FIX16(k_bossPartOffsets[i].y)   // y
+    };
+
+    hit = isHitboxOverlapping(g_bossPartHitbox, partPosition, playerHitbox,
+                              playerPosition);
+  }
+
+  if (hit) {
+    doPlayerHit(player);
+  }
+}
+
+static void draw(const Actor* _actor) {
+  BossData* data = (BossData*)getActorData(_actor);
+  const bool visible = isActorOnScreen(_actor);
+  const V2s16 origin = getActorScreenPosition(_actor);
+  V2s16 scroll = {0, 0};  // leaves the body off to the right of the screen
+
+  // the plane wraps every 512x256 pixels, the stage is short enough that the
+  // body never gets far enough off the top or bottom to wrap back in
+  if (visible) {
+    scroll.x = origin.x - BOSS_PLANE_X;
+    scroll.y = -origin.y;
+  }
+
+  if (scroll.x != data->scroll.x) {
+    VDP_setHorizontalScroll(BG_A, scroll.x);
+  }
+
+  if (scroll.y != data->scroll.y) {
+    VDP_setVerticalScroll(BG_A, scroll.y);
+  }
+
+  data->scroll = scroll;
+
+  // particles fall back to BG_A tiles on heavy frames, which only line up
+  // with the screen while the plane isn't scrolled
+  setParticleTilesAllowed(!visible);
+
+  for (u8 i = 0; i < BOSS_PARTS_MAX; i++) {
+    const V2s16 position = {
+      origin.x + g_bossExtent.x + k_bossPartOffsets[i].x - g_bossPartOffset.x,
+      origin.y + g_bossExtent.y + k_bossPartOffsets[i].y - g_bossPartOffset.y
+    };
+
+    drawEnemySprite(&data->parts[i], visible, position);
+  }
+}
+
+static void destroy(Actor* _actor) {
+  BossData* data = (BossData*)getActorData(_actor);
+
+  releaseEnemySprites(data->parts, BOSS_PARTS_MAX);
+
+  // only the body's own cells, anything else on the plane is left alone
+  VDP_clearTileMapRect(BG_A, BOSS_PLANE_X / 8, 0, k_boss1Image.tilemap->w,
+                       k_boss1Image.tilemap->h);
+  VDP_setHorizontalScroll(BG_A, 0);
+  VDP_setVerticalScroll(BG_A, 0);
+  setParticleTilesAllowed(TRUE);
+
+  g_bossActive = FALSE;
+
+  freeArena(data, sizeof(BossData), ARENA_TAG_ENEMIES);
+}
+
+// public functions
+
+void initBoss() {
+  g_bossExtent.x = k_boss1Image.tilemap->w * 4;
+  g_bossExtent.y = k_boss1Image.tilemap->h * 4;
+  g_bossPartOffset.x = k_mineSprite.w / 2;
+  g_bossPartOffset.y = k_mineSprite.h / 2;
+  g_bossPartHitbox = getHitbox(&k_mineHitboxes, 0, 0, FALSE);
+  g_bossEntrySpeed = k_bossEntrySpeeds[getFrameRateIndex()];
+  g_bossExitSpeed = k_bossExitSpeeds[getFrameRateIndex()];
+  g_bossHoldDuration = k_bossHoldDurations[getFrameRateIndex()];
+  g_bossActive = FALSE;
+
+  setUpTileMask(&g_bossMask, k_boss1Collision);
+
+  assert(g_bossMask.columns == k_boss1Image.tilemap->w &&
+           g_bossMask.rows == k_boss1Image.tilemap->h,
+         "Collision mask does not match the boss");
+}
+
+void createBoss(u16 _palette, u16 _tileIndex, V2f16 _position,
+                ActorHandle _player) {
+  // the body owns BG_A so there can only be one boss at a time
+  assert(!g_bossActive, "Only one boss can be active");
+
+  BossData* data = allocateArena(sizeof(BossData), ARENA_TAG_ENEMIES);
+
+  if (data == NULL) {
+    return;
+  }
+
+  const V2s16 partPosition = {0, 0};
+
+  for (u8 i = 0; i < BOSS_PARTS_MAX; i++) {
+    if (!setUpEnemySprite(&data->parts[i], &k_mineSprite, _palette,
+                          partPosition)) {
+      releaseEnemySprites(data->parts, i);
+      freeArena(data, sizeof(BossData), ARENA_TAG_ENEMIES);
+
+      return;
+    }
+  }
+
+  Actor* actor = createManagedActor(_position, data, &update, &draw, &destroy);
+
+  if (actor == NULL) {
+    releaseEnemySprites(data->parts, BOSS_PARTS_MAX);
+    freeArena(data, sizeof(BossData), ARENA_TAG_ENEMIES);
+
+    return;
+  }
+
+  const u16 bodyAttributes =
+    TILE_ATTR_FULL(_palette, FALSE, FALSE, FALSE, _tileIndex);
+
+  // drawn once, after that the body only ever moves by scrolling the plane
+  VDP_drawImageEx(BG_A, &k_boss1Image, bodyAttributes, BOSS_PLANE_X / 8, 0,
+                  FALSE, DMA);
+
+  data->scroll.x = 0;
+  data->scroll.y = 0;
+  data->state = BOSS_STATE_ENTERING;
+  data->timer = 0;
+  data->player = _player;
+
+  setUpPathFollower(&data->path, k_wavePaths);
+
+  setActorExtent(actor, g_bossExtent);
+
+  g_bossActive = TRUE;
+}
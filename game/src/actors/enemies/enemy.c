@@ -0,0 +1,84 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <genesis.h>
+
+#include "actors/enemies/enemy.h"
+
+// constants
+
+#define ENEMY_SPRITE_FLAGS                                                     \
+  (SPR_FLAG_AUTO_VRAM_ALLOC | SPR_FLAG_AUTO_TILE_UPLOAD)
+
+// public functions
+
+bool setUpEnemySprite(EnemySprite* _sprite, const SpriteDefinition* _definition,
+                      u16 _palette, V2s16 _position) {
+  const u16 attributes = TILE_ATTR(_palette, FALSE, FALSE, FALSE);
+  Sprite* sprite = SPR_addSpriteExSafe(_definition, _position.x, _position.y,
+                                       attributes, ENEMY_SPRITE_FLAGS);
+
+  if (sprite == NULL) {
+    return FALSE;
+  }
+
+  _sprite->sprite = sprite;
+  _sprite->position = _position;
+  _sprite->visible = FALSE;
+
+  SPR_setVisibility(sprite, HIDDEN);
+
+  return TRUE;
+}
+
+void drawEnemySprite(EnemySprite* _sprite, bool _visible, V2s16 _position) {
+  Sprite* sprite = _sprite->sprite;
+
+  if (_visible != _sprite->visible) {
+    SPR_setVisibility(sprite, _visible ? VISIBLE : HIDDEN);
+
+    _sprite->visible = _visible;
+  }
+
+  if (!_visible) {
+    return;
+  }
+
+  if (_position.x == _sprite->position.x &&
+      _position.y == _sprite->position.y) {
+    return;
+  }
+
+  SPR_setPosition(sprite, _position.x, _position.y);
+
+  _sprite->position = _position;
+}
+
+void releaseEnemySprite(EnemySprite* _sprite) {
+  SPR_releaseSprite(_sprite->sprite);
+}
+
+void releaseEnemySprites(EnemySprite _sprites[], u8 _count) {
+  for (u8 i = 0; i < _count; i++) {
+    SPR_releaseSprite(_sprites[i].sprite);
+  }
+}
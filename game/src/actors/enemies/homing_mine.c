@@ -24,124 +24,143 @@
 
 #include "actor.h"
 #include "actors/enemies/homing_mine.h"
+#include "actors/enemies/mine.h"
 #include "actors/player.h"
-#include "assert.h"
+#include "ai_scheduler.h"
+#include "arena.h"
+#include "hot_data.h"
+#include "kernels.h"
 #include "managed_actor.h"
 #include "sprites.h"
+#include "stage.h"
 #include "utilities.h"
 
 // constants
 
-#define HOMING_MINE_SPEED FIX32(1.5)
-#define HOMING_MINE_SPRITE_FLAGS                                               \
-  (SPR_FLAG_AUTO_VISIBILITY | SPR_FLAG_AUTO_VRAM_ALLOC |                       \
-   SPR_FLAG_AUTO_TILE_UPLOAD)
+#define HOMING_MINE_VELOCITY 75    // pixels/second
+#define HOMING_MINE_AI_INTERVAL 4  // frames
+
+static const f16 k_homingMineSpeeds[] = {
+  FIX16(NTSC_PER_FRAME(HOMING_MINE_VELOCITY)),  // ntsc
+  FIX16(PAL_PER_FRAME(HOMING_MINE_VELOCITY))    // pal
+};
 
 // global properties
 
-static V2s16 g_homingMineSpriteOffset;  // pixels
-static u8 g_homingMineExplosionRadius;  // pixels
-static u8 g_homingMineHomingRadius;     // pixels
-static f32 g_homingMineSpeed;           // pixels/frame
+static u8 g_homingMineHomingRadius;  // pixels
 
 typedef struct {
-  Sprite* sprite;
-  Actor* player;
-  bool exploded;
+  MineBody body;
+  AISchedule schedule;  // steering decisions
+  V2f16 velocity;       // pixels/frame
 } HomingMineData;
 
 // private functions
 
+static V2f16 getSteering(s32 _deltaX, s32 _deltaY, u8 _radius) {
+  const s32 homingRadius = FIX16(g_homingMineHomingRadius + _radius);
+  const s32 magnitude = (s32)getFastDistance(_deltaX, _deltaY);
+  V2f16 velocity = {0, 0};
+
+  if (magnitude <= homingRadius) {
+    // inside the homing radius everything fits in fix16
+    const f16 directionX = F16_div((f16)_deltaX, (f16)magnitude);
+    const f16 directionY = F16_div((f16)_deltaY, (f16)magnitude);
+
+    velocity.x = -F16_mul(directionX, HOT_DATA.homingMineSpeed);
+    velocity.y = -F16_mul(directionY, HOT_DATA.homingMineSpeed);
+  }
+
+  return velocity;
+}
+
 static void update(Actor* _actor, const Stage* _stage) {
   HomingMineData* data = (HomingMineData*)getActorData(_actor);
-  bool exploded = data->exploded;
 
-  if (exploded) {
+  if (data->body.exploded) {
     return;
   }
 
-  Actor* player = data->player;
-  V2f32 position = getActorPosition(_actor);
-  const V2f32 playerPosition = getActorPosition(player);
-  const f32 deltaX = position.x - playerPosition.x;
-  const f32 deltaY = position.y - playerPosition.y;
-  const u8 radius = getPlayerRadius(player);
-  const f32 homingRadius = FIX32(g_homingMineHomingRadius + radius);
-  const f32 explodeRadius = FIX32(g_homingMineExplosionRadius + radius);
-  const f32 magnitude = (f32)getApproximatedDistance((s32)deltaX, (s32)deltaY);
-
-  if (magnitude <= explodeRadius) {
-    exploded = TRUE;
-
-    setManagedActorCleanUp(_actor);
-    doPlayerHit(player);
-  } else if (magnitude <= homingRadius) {
-    const f32 speedX = F32_mul(F32_div(deltaX, magnitude), g_homingMineSpeed);
-    const f32 speedY = F32_mul(F32_div(deltaY, magnitude), g_homingMineSpeed);
-
-    position.x = position.x - speedX;
-    position.y = position.y - speedY;
-
-    setActorPosition(_actor, position);
-  }
+  Actor* player = resolveActorHandle(data->body.player);
 
-  data->exploded = exploded;
-}
+  if (player == NULL) {
+    return;
+  }
 
-static void draw(const Actor* _actor, const Camera* _camera) {
-  const HomingMineData* data = (const HomingMineData*)getActorData(_actor);
-  const bool exploded = data->exploded;
-  Sprite* sprite = data->sprite;
+  V2f16 position = getActorPosition(_actor);
 
-  if (exploded) {
-    SPR_setVisibility(sprite, HIDDEN);
+  collideMineBody(&data->body, _actor, position);
 
+  if (data->body.exploded) {
     return;
   }
 
-  const V2f32 position = getActorPosition(_actor);
-  const V2s32 cameraPosition = getCameraPositionRounded(_camera);
-  const u32 offsetX = g_homingMineSpriteOffset.x + cameraPosition.x;
-  const u32 offsetY = g_homingMineSpriteOffset.y + cameraPosition.y;
-  const u16 positionX = F32_toRoundedInt(position.x) - offsetX;
-  const u16 positionY = F32_toRoundedInt(position.y) - offsetY;
+  // steering is sliced across frames, moving along it is not
+  if (runAISchedule(&data->schedule, _actor)) {
+    const V2f16 playerPosition = getActorPosition(player);
+    const s32 deltaX = (s32)position.x - playerPosition.x;  // fix16 units
+    const s32 deltaY = (s32)position.y - playerPosition.y;  // fix16 units
+
+    data->velocity = getSteering(deltaX, deltaY, getPlayerRadius(player));
+  }
+
+  const V2f16 target = {
+    position.x + data->velocity.x,  // x
+    position.y + data->velocity.y   // y
+  };
+
+  position =
+    resolveStageMovement(_stage, position, target, getActorExtent(_actor));
 
-  SPR_setPosition(sprite, positionX, positionY);
+  setActorPosition(_actor, position);
+}
+
+static void draw(const Actor* _actor) {
+  HomingMineData* data = (HomingMineData*)getActorData(_actor);
+
+  drawMineBody(&data->body, _actor);
 }
 
 static void destroy(Actor* _actor) {
   HomingMineData* data = (HomingMineData*)getActorData(_actor);
 
-  SPR_releaseSprite(data->sprite);
-  free(data);
+  releaseMineBody(&data->body);
+  freeArena(data, sizeof(HomingMineData), ARENA_TAG_ENEMIES);
 }
 
 // public functions
 
 void initHomingMine() {
-  const u8 spriteHalfWidth = k_mineSprite.w / 2;
-
-  g_homingMineSpriteOffset.x = spriteHalfWidth;
-  g_homingMineSpriteOffset.x = k_mineSprite.h / 2;
-  g_homingMineExplosionRadius = spriteHalfWidth;
-  g_homingMineHomingRadius = spriteHalfWidth * 10;
-  g_homingMineSpeed = F32_div(FIX32(75), FIX32(getFrameRate()));
+  g_homingMineHomingRadius = k_mineSprite.w / 2 * 10;
+  HOT_DATA.homingMineSpeed = k_homingMineSpeeds[getFrameRateIndex()];
 }
 
-void createHomingMine(u16 _palette, V2f32 _position, Actor* _player) {
-  HomingMineData* data = malloc(sizeof(HomingMineData));
+void createHomingMine(u16 _palette, V2f16 _position, ActorHandle _player) {
+  HomingMineData* data =
+    allocateArena(sizeof(HomingMineData), ARENA_TAG_ENEMIES);
+
+  if (data == NULL) {
+    return;
+  }
+
+  if (!setUpMineBody(&data->body, _position, _palette, _player)) {
+    freeArena(data, sizeof(HomingMineData), ARENA_TAG_ENEMIES);
 
-  assert(data != NULL, "Failed to allocate mine homing data");
+    return;
+  }
 
-  data->player = _player;
-  data->exploded = FALSE;
+  Actor* actor = createManagedActor(_position, data, &update, &draw, &destroy);
 
-  const f32 x = F32_toRoundedInt(_position.x) + g_homingMineSpriteOffset.x;
-  const f32 y = F32_toRoundedInt(_position.y) + g_homingMineSpriteOffset.y;
-  const u16 attributes = TILE_ATTR(_palette, FALSE, FALSE, FALSE);
+  if (actor == NULL) {
+    releaseMineBody(&data->body);
+    freeArena(data, sizeof(HomingMineData), ARENA_TAG_ENEMIES);
+
+    return;
+  }
 
-  data->sprite = SPR_addSpriteExSafe(&k_mineSprite, x, y, attributes,
-                                     HOMING_MINE_SPRITE_FLAGS);
+  data->velocity.x = 0;
+  data->velocity.y = 0;
 
-  createManagedActor(_position, data, &update, &draw, &destroy);
+  setUpAISchedule(&data->schedule, HOMING_MINE_AI_INTERVAL);
+  setActorExtent(actor, getMineSpriteOffset());
 }
@@ -25,103 +25,137 @@
 #include "actor.h"
 #include "actors/enemies/mine.h"
 #include "actors/player.h"
+#include "arena.h"
 #include "assert.h"
+#include "audio.h"
+#include "hitbox.h"
+#include "hitboxes.h"
 #include "managed_actor.h"
+#include "particles.h"
+#include "path.h"
 #include "sprites.h"
 
-// constants
-#define MINE_SPRITE_FLAGS                                                      \
-  (SPR_FLAG_AUTO_VISIBILITY | SPR_FLAG_AUTO_VRAM_ALLOC |                       \
-   SPR_FLAG_AUTO_TILE_UPLOAD)
-
 // global properties
 
 static V2s16 g_mineSpriteOffset;  // pixels
-static u8 g_mineExplosionRadius;  // pixels
+static const Hitbox* g_mineHitbox;
 
 typedef struct {
-  Sprite* sprite;
-  Actor* player;
-  bool exploded;
+  MineBody body;
+  PathFollower path;
 } MineData;
 
 // private functions
 
 static void update(Actor* _actor, const Stage* _stage) {
   MineData* data = (MineData*)getActorData(_actor);
-  bool exploded = data->exploded;
 
-  if (exploded) {
+  if (data->body.exploded) {
     return;
   }
 
-  Actor* player = data->player;
-  const u8 radius = getPlayerRadius(player);
-  const f32 explodeRadius = FIX32(g_mineExplosionRadius + radius);
-  const f32 magnitude = getDistanceBetweenActors(_actor, player);
-
-  if (magnitude <= explodeRadius) {
-    exploded = TRUE;
+  V2f16 position = getActorPosition(_actor);
 
-    setManagedActorCleanUp(_actor);
-    doPlayerHit(player);
+  if (advancePath(&data->path, &position)) {
+    setActorPosition(_actor, position);
   }
 
-  data->exploded = exploded;
+  collideMineBody(&data->body, _actor, position);
+}
+
+static void draw(const Actor* _actor) {
+  MineData* data = (MineData*)getActorData(_actor);
+
+  drawMineBody(&data->body, _actor);
+}
+
+static void destroy(Actor* _actor) {
+  MineData* data = (MineData*)getActorData(_actor);
+
+  releaseMineBody(&data->body);
+  freeArena(data, sizeof(MineData), ARENA_TAG_ENEMIES);
 }
 
-static void draw(const Actor* _actor, const Camera* _camera) {
-  const MineData* data = (const MineData*)getActorData(_actor);
-  const bool exploded = data->exploded;
-  Sprite* sprite = data->sprite;
+// public functions
 
-  if (exploded) {
-    SPR_setVisibility(sprite, HIDDEN);
+void initMine() {
+  g_mineSpriteOffset.x = k_mineSprite.w / 2;
+  g_mineSpriteOffset.y = k_mineSprite.h / 2;
+  g_mineHitbox = getHitbox(&k_mineHitboxes, 0, 0, FALSE);
+}
+
+void createMine(u16 _palette, V2f16 _position, const Path _paths[],
+                ActorHandle _player) {
+  MineData* data = allocateArena(sizeof(MineData), ARENA_TAG_ENEMIES);
 
+  if (data == NULL) {
     return;
   }
 
-  const V2f32 position = getActorPosition(_actor);
-  const V2s32 cameraPosition = getCameraPositionRounded(_camera);
-  const u32 offsetX = g_mineSpriteOffset.x + cameraPosition.x;
-  const u32 offsetY = g_mineSpriteOffset.y + cameraPosition.y;
-  const u16 positionX = F32_toRoundedInt(position.x) - offsetX;
-  const u16 positionY = F32_toRoundedInt(position.y) - offsetY;
+  if (!setUpMineBody(&data->body, _position, _palette, _player)) {
+    freeArena(data, sizeof(MineData), ARENA_TAG_ENEMIES);
 
-  SPR_setPosition(sprite, positionX, positionY);
+    return;
+  }
+
+  Actor* actor = createManagedActor(_position, data, &update, &draw, &destroy);
+
+  if (actor == NULL) {
+    releaseMineBody(&data->body);
+    freeArena(data, sizeof(MineData), ARENA_TAG_ENEMIES);
+
+    return;
+  }
+
+  setUpPathFollower(&data->path, _paths);
+  setActorExtent(actor, g_mineSpriteOffset);
 }
 
-static void destroy(Actor* _actor) {
-  MineData* data = (MineData*)getActorData(_actor);
+bool setUpMineBody(MineBody* _body, V2f16 _position, u16 _palette,
+                   ActorHandle _player) {
+  const V2s16 spritePosition = {
+    F16_toRoundedInt(_position.x) + g_mineSpriteOffset.x,  // x
+    F16_toRoundedInt(_position.y) + g_mineSpriteOffset.y   // y
+  };
+
+  _body->player = _player;
+  _body->exploded = FALSE;
 
-  SPR_releaseSprite(data->sprite);
-  free(data);
+  return setUpEnemySprite(&_body->sprite, &k_mineSprite, _palette,
+                          spritePosition);
 }
 
-// public functions
+void drawMineBody(MineBody* _body, const Actor* _actor) {
+  const bool visible = !_body->exploded && isActorOnScreen(_actor);
 
-void initMine() {
-  const u8 spriteHalfWidth = k_mineSprite.w / 2;
+  drawEnemySprite(&_body->sprite, visible, getActorScreenPosition(_actor));
+}
 
-  g_mineSpriteOffset.x = spriteHalfWidth;
-  g_mineSpriteOffset.y = k_mineSprite.h / 2;
-  g_mineExplosionRadius = spriteHalfWidth;
+void releaseMineBody(MineBody* _body) {
+  releaseEnemySprite(&_body->sprite);
 }
 
-void createMine(u16 _palette, V2f32 _position, Actor* _player) {
-  MineData* data = malloc(sizeof(MineData));
+void collideMineBody(MineBody* _body, Actor* _actor, V2f16 _position) {
+  Actor* player = resolveActorHandle(_body->player);
 
-  assert(data != NULL, "Failed to allocate mine data");
+  if (player == NULL ||
+      !isHitboxOverlapping(g_mineHitbox, _position, getPlayerHitbox(player),
+                           getActorPosition(player))) {
+    return;
+  }
 
-  data->player = _player;
-  data->exploded = FALSE;
+  _body->exploded = TRUE;
 
-  const f32 x = F32_toRoundedInt(_position.x) + g_mineSpriteOffset.x;
-  const f32 y = F32_toRoundedInt(_position.y) + g_mineSpriteOffset.y;
-  const u16 attributes = TILE_ATTR(_palette, FALSE, FALSE, FALSE);
+  setManagedActorCleanUp(_actor);
+  spawnExplosion(_position, PARTICLE_PRIORITY_NORMAL);
+  playSoundEffect(SOUND_EFFECT_EXPLOSION);
+  doPlayerHit(player);
+}
 
-  data->sprite =
-    SPR_addSpriteExSafe(&k_mineSprite, x, y, attributes, MINE_SPRITE_FLAGS);
+V2s16 getMineSpriteOffset() {
+  return g_mineSpriteOffset;
+}
 
-  createManagedActor(_position, data, &update, &draw, &destroy);
+const Hitbox* getMineHitbox() {
+  return g_mineHitbox;
 }
@@ -0,0 +1,231 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <genesis.h>
+
+#include "actor.h"
+#include "actors/enemies/enemy.h"
+#include "actors/enemies/mine.h"
+#include "actors/enemies/mine_formation.h"
+#include "actors/player.h"
+#include "arena.h"
+#include "assert.h"
+#include "audio.h"
+#include "hitbox.h"
+#include "managed_actor.h"
+#include "particles.h"
+#include "path.h"
+#include "sprites.h"
+
+// constants
+
+#define MINE_FORMATION_MEMBERS_MAX 12
+
+// pixels, relative to the formation position
+static const V2s16 k_mineFormationLineOffsets[] = {
+  {-48, 0}, {-24, 0}, {0, 0}, {24, 0}, {48, 0}
+};
+static const V2s16 k_mineFormationColumnOffsets[] = {
+  {0, -48}, {0, -24}, {0, 0}, {0, 24}, {0, 48}
+};
+static const V2s16 k_mineFormationVeeOffsets[] = {
+  {-24, 0}, {-8, -20}, {-8, 20}, {8, -40}, {8, 40}, {24, -60}, {24, 60}
+};
+static const V2s16* const k_mineFormationOffsets[] = {
+  k_mineFormationLineOffsets,    // line
+  k_mineFormationColumnOffsets,  // column
+  k_mineFormationVeeOffsets      // vee
+};
+static const u8 k_mineFormationCounts[] = {
+  sizeof(k_mineFormationLineOffsets) / sizeof(V2s16),    // line
+  sizeof(k_mineFormationColumnOffsets) / sizeof(V2s16),  // column
+  sizeof(k_mineFormationVeeOffsets) / sizeof(V2s16)      // vee
+};
+
+// entity
+
+typedef struct {
+  EnemySprite members[MINE_FORMATION_MEMBERS_MAX];
+  u16 alive;  // one bit per member
+  const V2s16* offsets;
+  u8 count;
+  PathFollower path;
+  ActorHandle player;
+} MineFormationData;
+
+// private functions
+
+static void update(Actor* _actor, const Stage* _stage) {
+  MineFormationData* data = (MineFormationData*)getActorData(_actor);
+  u16 alive = data->alive;
+
+  if (alive == 0) {
+    return;
+  }
+
+  // the whole group moves as one, members never integrate on their own
+  V2f16 position = getActorPosition(_actor);
+
+  if (advancePath(&data->path, &position)) {
+    setActorPosition(_actor, position);
+  }
+
+  Actor* player = resolveActorHandle(data->player);
+
+  if (player == NULL) {
+    return;
+  }
+
+  const V2f16 playerPosition = getActorPosition(player);
+  const V2s16 extent = getActorExtent(_actor);
+  const s16 reach = getPlayerRadius(player);
+  const s16 x = F16_toInt(position.x);
+  const s16 y = F16_toInt(position.y);
+
+  // the group bounds reject the player before any member is looked at
+  if (abs(F16_toInt(playerPosition.x) - x) > extent.x + reach ||
+      abs(F16_toInt(playerPosition.y) - y) > extent.y + reach) {
+    return;
+  }
+
+  const Hitbox* hitbox = getMineHitbox();
+  const Hitbox* playerHitbox = getPlayerHitbox(player);
+  const V2s16* offset = data->offsets;
+
+  for (u8 i = 0; i < data->count; i++, offset++) {
+    const u16 member = 1 << i;
+
+    if (!(alive & member)) {
+      continue;
+    }
+
+    const V2f16 memberPosition = {
+      position.x + FIX16(offset->x),  // x
+      position.y + FIX16(offset->y)   // y
+    };
+
+    if (isHitboxOverlapping(hitbox, memberPosition, playerHitbox,
+                            playerPosition)) {
+      alive &= ~member;
+
+      spawnExplosion(memberPosition, PARTICLE_PRIORITY_NORMAL);
+      playSoundEffect(SOUND_EFFECT_EXPLOSION);
+      doPlayerHit(player);
+    }
+  }
+
+  data->alive = alive;
+
+  if (alive == 0) {
+    setManagedActorCleanUp(_actor);
+  }
+}
+
+static void draw(const Actor* _actor) {
+  MineFormationData* data = (MineFormationData*)getActorData(_actor);
+  const u16 alive = isActorOnScreen(_actor) ? data->alive : 0;
+  const V2s16 extent = getActorExtent(_actor);
+  const V2s16 spriteOffset = getMineSpriteOffset();
+  const V2s16 origin = getActorScreenPosition(_actor);
+  const V2s16* offset = data->offsets;
+  EnemySprite* member = data->members;
+
+  // culling was done once for the group, members only differ by an offset
+  for (u8 i = 0; i < data->count; i++, offset++, member++) {
+    const V2s16 position = {
+      origin.x + extent.x + offset->x - spriteOffset.x,  // x
+      origin.y + extent.y + offset->y - spriteOffset.y   // y
+    };
+
+    drawEnemySprite(member, (alive >> i) & 1, position);
+  }
+}
+
+static void destroy(Actor* _actor) {
+  MineFormationData* data = (MineFormationData*)getActorData(_actor);
+
+  releaseEnemySprites(data->members, data->count);
+  freeArena(data, sizeof(MineFormationData), ARENA_TAG_ENEMIES);
+}
+
+// public functions
+
+void createMineFormation(u16 _palette, V2f16 _position,
+                         MineFormationShape _shape, const Path _paths[],
+                         ActorHandle _player) {
+  assert(_shape < MINE_FORMATION_SHAPE_COUNT, "Unknown mine formation shape");
+
+  MineFormationData* data =
+    allocateArena(sizeof(MineFormationData), ARENA_TAG_ENEMIES);
+
+  if (data == NULL) {
+    return;
+  }
+
+  const V2s16* offsets = k_mineFormationOffsets[_shape];
+  const u8 count = k_mineFormationCounts[_shape];
+  const V2s16 spriteOffset = getMineSpriteOffset();
+  const s16 x = F16_toRoundedInt(_position.x);
+  const s16 y = F16_toRoundedInt(_position.y);
+  V2s16 extent = {0, 0};
+
+  assert(count <= MINE_FORMATION_MEMBERS_MAX, "Mine formation too large");
+
+  // sprites come first so running out of them never spawns half a formation
+  for (u8 i = 0; i < count; i++) {
+    const V2s16 offset = offsets[i];
+    const V2s16 position = {
+      x + offset.x - spriteOffset.x,  // x
+      y + offset.y - spriteOffset.y   // y
+    };
+
+    if (!setUpEnemySprite(&data->members[i], &k_mineSprite, _palette,
+                          position)) {
+      releaseEnemySprites(data->members, i);
+      freeArena(data, sizeof(MineFormationData), ARENA_TAG_ENEMIES);
+
+      return;
+    }
+
+    extent.x = max(extent.x, abs(offset.x) + spriteOffset.x);
+    extent.y = max(extent.y, abs(offset.y) + spriteOffset.y);
+  }
+
+  Actor* actor = createManagedActor(_position, data, &update, &draw, &destroy);
+
+  if (actor == NULL) {
+    releaseEnemySprites(data->members, count);
+    freeArena(data, sizeof(MineFormationData), ARENA_TAG_ENEMIES);
+
+    return;
+  }
+
+  data->offsets = offsets;
+  data->count = count;
+  data->alive = (1 << count) - 1;
+  data->player = _player;
+
+  setUpPathFollower(&data->path, _paths);
+
+  // one set of bounds covers every member for culling and collision
+  setActorExtent(actor, extent);
+}
@@ -0,0 +1,104 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <genesis.h>
+
+#include "actor.h"
+#include "actors/enemies/mine.h"
+#include "actors/enemies/scripted_mine.h"
+#include "arena.h"
+#include "managed_actor.h"
+#include "script.h"
+
+// entity
+
+typedef struct {
+  MineBody body;
+  ScriptRunner script;
+} ScriptedMineData;
+
+// private functions
+
+static void update(Actor* _actor, const Stage* _stage) {
+  ScriptedMineData* data = (ScriptedMineData*)getActorData(_actor);
+
+  if (data->body.exploded) {
+    return;
+  }
+
+  // there are no projectiles yet so fire instructions have nothing to spawn
+  const ScriptResult result =
+    runScript(&data->script, _actor, data->body.player, NULL);
+
+  if (result == SCRIPT_RESULT_DESPAWN) {
+    data->body.exploded = TRUE;
+
+    setManagedActorCleanUp(_actor);
+
+    return;
+  }
+
+  collideMineBody(&data->body, _actor, getActorPosition(_actor));
+}
+
+static void draw(const Actor* _actor) {
+  ScriptedMineData* data = (ScriptedMineData*)getActorData(_actor);
+
+  drawMineBody(&data->body, _actor);
+}
+
+static void destroy(Actor* _actor) {
+  ScriptedMineData* data = (ScriptedMineData*)getActorData(_actor);
+
+  releaseMineBody(&data->body);
+  freeArena(data, sizeof(ScriptedMineData), ARENA_TAG_ENEMIES);
+}
+
+// public functions
+
+void createScriptedMine(u16 _palette, V2f16 _position, const Script _scripts[],
+                        ActorHandle _player) {
+  ScriptedMineData* data =
+    allocateArena(sizeof(ScriptedMineData), ARENA_TAG_ENEMIES);
+
+  if (data == NULL) {
+    return;
+  }
+
+  if (!setUpMineBody(&data->body, _position, _palette, _player)) {
+    freeArena(data, sizeof(ScriptedMineData), ARENA_TAG_ENEMIES);
+
+    return;
+  }
+
+  Actor* actor = createManagedActor(_position, data, &update, &draw, &destroy);
+
+  if (actor == NULL) {
+    releaseMineBody(&data->body);
+    freeArena(data, sizeof(ScriptedMineData), ARENA_TAG_ENEMIES);
+
+    return;
+  }
+
+  setUpScriptRunner(&data->script, _scripts);
+  setActorExtent(actor, getMineSpriteOffset());
+}
@@ -24,79 +24,137 @@
 
 #include "actor.h"
 #include "actors/player.h"
+#include "arena.h"
 #include "assert.h"
+#include "audio.h"
 #include "camera.h"
+#include "governor.h"
+#include "hitbox.h"
+#include "hitboxes.h"
+#include "hot_data.h"
+#include "input.h"
 #include "sprites.h"
 #include "stage.h"
+#include "trace.h"
 #include "utilities.h"
 
 // constants
 
-#define PLAYER_SCREEN_BUFFER 2                         // pixels
-#define PLAYER_ATTACK_COOLDOWN_DEFAULT 0               // seconds
-#define PLAYER_ATTACK_COOLDOWN_DURATION (FIX16(0.05))  // seconds
-#define PLAYER_DAMAGE_COOLDOWN_DEFAULT 0               // seconds
-#define PLAYER_DAMAGE_COOLDOWN_DURATION (FIX16(1))     // seconds
+#define PLAYER_SCREEN_BUFFER 2                // pixels
+#define PLAYER_VELOCITY 120                   // pixels/second
+#define PLAYER_BANKING_RATE 20                // per second
+#define PLAYER_ATTACK_COOLDOWN_DEFAULT 0      // frames
+#define PLAYER_ATTACK_COOLDOWN_DURATION 0.05  // seconds
+#define PLAYER_DAMAGE_COOLDOWN_DEFAULT 0      // frames
+#define PLAYER_DAMAGE_COOLDOWN_DURATION 1     // seconds
 #define PLAYER_BANKING_DIRECTION_DEFAULT 0
 #define PLAYER_BANKING_DIRECTION_MAX_DOWN (FIX16(2))
 #define PLAYER_BANKING_DIRECTION_MAX_UP (-PLAYER_BANKING_DIRECTION_MAX_DOWN)
 #define PLAYER_HEALTH_DEFAULT 2
+#define PLAYER_SPRITE_FRAME_LEVEL 0
+#define PLAYER_SPRITE_FRAME_BANKING 1
+#define PLAYER_SPRITE_FRAME_BANKING_FULL 2
 #define PLAYER_SPRITE_FLAGS                                                    \
-  (SPR_FLAG_AUTO_VISIBILITY | SPR_FLAG_AUTO_VRAM_ALLOC |                       \
-   SPR_FLAG_AUTO_TILE_UPLOAD)
+  (SPR_FLAG_AUTO_VRAM_ALLOC | SPR_FLAG_AUTO_TILE_UPLOAD)
+
+static const u8 k_playerSpriteAnimations[] = {
+  0,  // level
+  1,  // banking
+  1   // banking full
+};
+static const u8 k_playerSpriteAnimationFrames[] = {
+  0,  // level
+  0,  // banking
+  1   // banking full
+};
+static const f16 k_playerVelocities[] = {
+  FIX16(NTSC_PER_FRAME(PLAYER_VELOCITY)),  // ntsc
+  FIX16(PAL_PER_FRAME(PLAYER_VELOCITY))    // pal
+};
+static const f16 k_playerBankingRates[] = {
+  FIX16(NTSC_PER_FRAME(PLAYER_BANKING_RATE)),  // ntsc
+  FIX16(PAL_PER_FRAME(PLAYER_BANKING_RATE))    // pal
+};
+static const u16 k_playerAttackCooldownDurations[] = {
+  NTSC_SECONDS_TO_FRAMES(PLAYER_ATTACK_COOLDOWN_DURATION),  // ntsc
+  PAL_SECONDS_TO_FRAMES(PLAYER_ATTACK_COOLDOWN_DURATION)    // pal
+};
+static const u16 k_playerDamageCooldownDurations[] = {
+  NTSC_SECONDS_TO_FRAMES(PLAYER_DAMAGE_COOLDOWN_DURATION),  // ntsc
+  PAL_SECONDS_TO_FRAMES(PLAYER_DAMAGE_COOLDOWN_DURATION)    // pal
+};
 
 // global properties
 
-static V2f32 g_playerBuffer;        // pixels
-static V2s16 g_playerSpriteOffset;  // pixels
-static f32 g_playerVelocity;        // pixels/frame
-static f16 g_playerBankingRate;     // fps
+static V2f16 g_playerBuffer;                // pixels
+static V2s16 g_playerSpriteOffset;          // pixels
+static f16 g_playerBankingRate;             // per frame
+static u16 g_playerAttackCooldownDuration;  // frames
+static u16 g_playerDamageCooldownDuration;  // frames
 
 typedef struct {
   Sprite* sprite;
+  V2s16 spritePosition;  // last submitted, pixels
+  u8 spriteFrame;        // last submitted
+  bool spriteFlipped;    // last submitted
+  bool spriteVisible;    // last submitted
+  u8 frame;
+  bool flipped;
+  const Hitbox* hitbox;  // matches frame and flipped
   f16 bankDirection;
-  f16 attackCooldown;
-  f16 damageCooldown;
-  u8 radius;
+  u16 attackCooldown;  // frames
+  u16 damageCooldown;  // frames
   u8 health;
 } PlayerData;
 
 // private functions
 
 static void processMovement(Actor* _actor, PlayerData* _data,
-                            const Stage* _stage) {
-  V2f32 position = getActorPosition(_actor);
-  const f32 previousPositionY = position.y;
-  const u16 inputState = JOY_readJoypad(JOY_1);
+                            const Stage* _stage, u16 _inputState) {
+  const V2f16 previousPosition = getActorPosition(_actor);
+  V2f16 position = previousPosition;
   f16 bankDirection = _data->bankDirection;
 
-  position.x = position.x + _stage->speed;
+  position.x = position.x + _stage->scroll;
 
-  if (inputState & BUTTON_LEFT) {
-    position.x = position.x - g_playerVelocity;
+  if (_inputState & BUTTON_LEFT) {
+    position.x = position.x - HOT_DATA.playerVelocity;
   }
 
-  if (inputState & BUTTON_RIGHT) {
-    position.x = position.x + g_playerVelocity;
+  if (_inputState & BUTTON_RIGHT) {
+    position.x = position.x + HOT_DATA.playerVelocity;
   }
 
-  if (inputState & BUTTON_UP) {
-    position.y = position.y - g_playerVelocity;
+  if (_inputState & BUTTON_UP) {
+    position.y = position.y - HOT_DATA.playerVelocity;
   }
 
-  if (inputState & BUTTON_DOWN) {
-    position.y = position.y + g_playerVelocity;
+  if (_inputState & BUTTON_DOWN) {
+    position.y = position.y + HOT_DATA.playerVelocity;
   }
 
-  const f32 minimumX = _stage->minimumX + g_playerBuffer.x;
-  const f32 maximumX = _stage->maximumX - g_playerBuffer.x;
-  const f32 minimumY = g_playerBuffer.y;
-  const f32 maximumY = FIX32(_stage->height) - g_playerBuffer.y;
+  const f16 minimumX = _stage->localMinimum.x + g_playerBuffer.x;
+  const f16 maximumX = _stage->localMaximum.x - g_playerBuffer.x;
+  const f16 minimumY = _stage->localMinimum.y + g_playerBuffer.y;
+  const f16 maximumY = _stage->localMaximum.y - g_playerBuffer.y;
 
+  position = resolveStageMovement(_stage, previousPosition, position,
+                                  getActorExtent(_actor));
+
+  // the scroll can still push the ship into terrain at the screen edge
   position.x = clamp(position.x, minimumX, maximumX);
   position.y = clamp(position.y, minimumY, maximumY);
 
-  const s8 deltaY = F32_toRoundedInt(previousPositionY - position.y);
+  setActorPosition(_actor, position);
+
+  // banking is purely cosmetic so it can be dropped under load
+  if (isGovernorLevelAtLeast(GOVERNOR_LEVEL_NO_BANKING)) {
+    _data->bankDirection = PLAYER_BANKING_DIRECTION_DEFAULT;
+
+    return;
+  }
+
+  const s8 deltaY = F16_toRoundedInt(previousPosition.y - position.y);
 
   if (deltaY == 0) {
     if (bankDirection < PLAYER_BANKING_DIRECTION_DEFAULT) {
@@ -112,32 +170,50 @@ static void processMovement(Actor* _actor, PlayerData* _data,
 
   _data->bankDirection = clamp(bankDirection, PLAYER_BANKING_DIRECTION_MAX_UP,
                                PLAYER_BANKING_DIRECTION_MAX_DOWN);
+}
 
-  setActorPosition(_actor, position);
+static void processFrame(PlayerData* _data) {
+  const f16 bankDirection = _data->bankDirection;
+  const f16 bankMagnitude = abs(bankDirection);
+  const bool flipped = bankDirection > 0;
+  u8 frame;
+
+  if (bankMagnitude >= FIX16(2)) {
+    frame = PLAYER_SPRITE_FRAME_BANKING_FULL;
+  } else if (bankMagnitude >= FIX16(1)) {
+    frame = PLAYER_SPRITE_FRAME_BANKING;
+  } else {
+    frame = PLAYER_SPRITE_FRAME_LEVEL;
+  }
+
+  if (frame == _data->frame && flipped == _data->flipped) {
+    return;
+  }
+
+  // collision has to follow the banking frame the sprite will show
+  _data->frame = frame;
+  _data->flipped = flipped;
+  _data->hitbox = getHitbox(&k_shipHitboxes, k_playerSpriteAnimations[frame],
+                            k_playerSpriteAnimationFrames[frame], flipped);
 }
 
-static void processAttack(PlayerData* _data) {
-  const u16 inputState = JOY_readJoypad(JOY_1);
-  f16 attackCooldown = _data->attackCooldown;
+static void processAttack(PlayerData* _data, u16 _inputState) {
+  u16 attackCooldown = _data->attackCooldown;
 
   if (attackCooldown > 0) {
-    const f16 deltaTime = F32_toFix16(getFrameDeltaTime());
-
-    attackCooldown = attackCooldown - deltaTime;
-  } else if ((inputState & BUTTON_A)) {
-    attackCooldown = PLAYER_ATTACK_COOLDOWN_DURATION;
+    attackCooldown--;
+  } else if ((_inputState & BUTTON_A)) {
+    attackCooldown = g_playerAttackCooldownDuration;
   }
 
   _data->attackCooldown = attackCooldown;
 }
 
 static void processDamage(PlayerData* _data) {
-  f16 damageCooldown = _data->damageCooldown;
+  u16 damageCooldown = _data->damageCooldown;
 
   if (damageCooldown > 0) {
-    const f16 deltaTime = F32_toFix16(getFrameDeltaTime());
-
-    damageCooldown = damageCooldown - deltaTime;
+    damageCooldown--;
   }
 
   _data->damageCooldown = damageCooldown;
@@ -150,53 +226,68 @@ static void update(Actor* _actor, const Stage* _stage) {
     return;
   }
 
-  processMovement(_actor, data, _stage);
-  processAttack(data);
+  // read once so movement and attack see the same buttons
+  const u16 inputState = readInput(_actor, _stage);
+
+  processMovement(_actor, data, _stage, inputState);
+  processFrame(data);
+  processAttack(data, inputState);
   processDamage(data);
 }
 
-static void draw(const Actor* _actor, const Camera* _camera) {
-  const V2f32 position = getActorPosition(_actor);
-  const V2s32 cameraPosition = getCameraPositionRounded(_camera);
-  const u32 offsetX = g_playerSpriteOffset.x + cameraPosition.x;
-  const u32 offsetY = g_playerSpriteOffset.y + cameraPosition.y;
-  const u16 positionX = F32_toRoundedInt(position.x) - offsetX;
-  const u16 positionY = F32_toRoundedInt(position.y) - offsetY;
-  const PlayerData* data = (const PlayerData*)getActorData(_actor);
-  const f16 bankDirection = data->bankDirection;
-  const f16 bankMagnitude = abs(bankDirection);
+static void draw(const Actor* _actor) {
+  PlayerData* data = (PlayerData*)getActorData(_actor);
   Sprite* sprite = data->sprite;
-  SpriteVisibility visibility;
+  bool visible = isActorOnScreen(_actor);
 
-  if (data->damageCooldown > 0) {
-    visibility = SPR_isVisible(sprite, FALSE) ? HIDDEN : VISIBLE;
-  } else {
-    visibility = VISIBLE;
+  if (visible && data->damageCooldown > 0 &&
+      !isGovernorLevelAtLeast(GOVERNOR_LEVEL_NO_BLINKING)) {
+    visible = !data->spriteVisible;
   }
 
-  SPR_setVisibility(sprite, visibility);
+  if (visible != data->spriteVisible) {
+    SPR_setVisibility(sprite, visible ? VISIBLE : HIDDEN);
 
-  if (visibility != VISIBLE) {
+    data->spriteVisible = visible;
+  }
+
+  if (!visible) {
     return;
   }
 
-  SPR_setPosition(sprite, positionX, positionY);
-  SPR_setVFlip(sprite, bankDirection > 0);
+  const V2s16 position = getActorScreenPosition(_actor);
 
-  if (bankMagnitude >= FIX16(2)) {
-    SPR_setAnimAndFrame(sprite, 1, 1);
-  } else if (bankMagnitude >= FIX16(1)) {
-    SPR_setAnimAndFrame(sprite, 1, 0);
-  } else {
-    SPR_setAnim(sprite, 0);
+  if (position.x != data->spritePosition.x ||
+      position.y != data->spritePosition.y) {
+    SPR_setPosition(sprite, position.x, position.y);
+
+    data->spritePosition = position;
+  }
+
+  const bool flipped = data->flipped;
+  const u8 frame = data->frame;
+
+  if (flipped != data->spriteFlipped) {
+    SPR_setVFlip(sprite, flipped);
+
+    data->spriteFlipped = flipped;
   }
+
+  if (frame == data->spriteFrame) {
+    return;
+  }
+
+  SPR_setAnimAndFrame(sprite, k_playerSpriteAnimations[frame],
+                      k_playerSpriteAnimationFrames[frame]);
+
+  data->spriteFrame = frame;
 }
 
 static void destroy(Actor* _actor) {
   PlayerData* data = (PlayerData*)getActorData(_actor);
 
   SPR_releaseSprite(data->sprite);
-  free(data);
+  freeArena(data, sizeof(PlayerData), ARENA_TAG_PLAYER);
 }
 
 // public functions
@@ -206,59 +297,98 @@ void initPlayer() {
     k_shipSprite.w / 2,  // x
     k_shipSprite.h / 2   // y
   };
-  const V2f32 buffer = {
-    FIX32(PLAYER_SCREEN_BUFFER + spriteOffset.x),  // x
-    FIX32(PLAYER_SCREEN_BUFFER + spriteOffset.y),  // y
+  const V2f16 buffer = {
+    FIX16(PLAYER_SCREEN_BUFFER + spriteOffset.x),  // x
+    FIX16(PLAYER_SCREEN_BUFFER + spriteOffset.y),  // y
   };
-  const u8 fps = getFrameRate();
+  const u8 index = getFrameRateIndex();
 
   g_playerSpriteOffset = spriteOffset;
   g_playerBuffer = buffer;
-  g_playerVelocity = F32_div(FIX32(120), FIX32(fps));
-  g_playerBankingRate = F16_div(FIX16(20), FIX16(fps));
+  HOT_DATA.playerVelocity = k_playerVelocities[index];
+  g_playerBankingRate = k_playerBankingRates[index];
+  g_playerAttackCooldownDuration = k_playerAttackCooldownDurations[index];
+  g_playerDamageCooldownDuration = k_playerDamageCooldownDurations[index];
 }
 
-Actor* createPlayer(u16 _palette, const V2f32 _position) {
-  PlayerData* data = malloc(sizeof(PlayerData));
+Actor* createPlayer(u16 _palette, const V2f16 _position) {
+  PlayerData* data = allocateArena(sizeof(PlayerData), ARENA_TAG_PLAYER);
+
+  if (data == NULL) {
+    return NULL;
+  }
+
+  Actor* actor = createActor(_position, data, &update, &draw, &destroy);
+
+  if (actor == NULL) {
+    freeArena(data, sizeof(PlayerData), ARENA_TAG_PLAYER);
 
-  assert(data != NULL, "Failed to allocate player data");
+    return NULL;
+  }
 
   data->bankDirection = PLAYER_BANKING_DIRECTION_DEFAULT;
   data->attackCooldown = PLAYER_ATTACK_COOLDOWN_DEFAULT;
   data->damageCooldown = PLAYER_DAMAGE_COOLDOWN_DEFAULT;
   data->health = PLAYER_HEALTH_DEFAULT;
-  data->radius = k_shipSprite.w / 2;
+  data->frame = PLAYER_SPRITE_FRAME_LEVEL;
+  data->flipped = FALSE;
+  data->hitbox = getHitbox(&k_shipHitboxes, 0, 0, FALSE);
 
-  const u16 x = F32_toRoundedInt(_position.x) + g_playerSpriteOffset.x;
-  const u16 y = F32_toRoundedInt(_position.y) + g_playerSpriteOffset.y;
+  const s16 x = F16_toRoundedInt(_position.x) + g_playerSpriteOffset.x;
+  const s16 y = F16_toRoundedInt(_position.y) + g_playerSpriteOffset.y;
   const u16 attributes = TILE_ATTR(_palette, TRUE, FALSE, FALSE);
 
   data->sprite =
     SPR_addSpriteExSafe(&k_shipSprite, x, y, attributes, PLAYER_SPRITE_FLAGS);
+  data->spritePosition.x = x;
+  data->spritePosition.y = y;
+  data->spriteFrame = PLAYER_SPRITE_FRAME_LEVEL;
+  data->spriteFlipped = FALSE;
+  data->spriteVisible = FALSE;
+
+  // visibility is driven by the camera culling and damage blink in draw
+  SPR_setVisibility(data->sprite, HIDDEN);
 
-  return createActor(_position, data, &update, &draw, &destroy);
+  setActorExtent(actor, g_playerSpriteOffset);
+
+  return actor;
 }
 
 void doPlayerHit(Actor* _actor) {
   PlayerData* data = (PlayerData*)getActorData(_actor);
-  f16 damageCooldown = data->damageCooldown;
+  u16 damageCooldown = data->damageCooldown;
   u8 health = data->health;
 
   if (health == 0 || damageCooldown > PLAYER_DAMAGE_COOLDOWN_DEFAULT) {
     return;
   }
 
-  damageCooldown = PLAYER_DAMAGE_COOLDOWN_DURATION;
+  damageCooldown = g_playerDamageCooldownDuration;
   health--;
 
   data->health = health;
   data->damageCooldown = damageCooldown;
+
+  playSoundEffect(SOUND_EFFECT_HIT);
+  trace(TRACE_EVENT_PLAYER_HIT, health, 0);
 }
 
 u8 getPlayerRadius(const Actor* _actor) {
   const PlayerData* data = (const PlayerData*)getActorData(_actor);
 
-  return data->radius;
+  return data->hitbox->radius;
+}
+
+const Hitbox* getPlayerHitbox(const Actor* _actor) {
+  const PlayerData* data = (const PlayerData*)getActorData(_actor);
+
+  return data->hitbox;
+}
+
+u8 getPlayerHealth(const Actor* _actor) {
+  const PlayerData* data = (const PlayerData*)getActorData(_actor);
+
+  return data->health;
 }
 
 bool isPlayerDead(const Actor* _actor) {
@@ -0,0 +1,89 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <genesis.h>
+
+#include "actor.h"
+#include "ai_scheduler.h"
+#include "assert.h"
+#include "governor.h"
+#include "hot_data.h"
+
+// constants
+
+#define AI_SCHEDULER_BUDGET 8             // decisions/frame
+#define AI_SCHEDULER_OFF_SCREEN_FACTOR 4  // interval multiplier
+#define AI_SCHEDULER_INTERVAL_MAX 255     // frames, what the countdown holds
+
+// global properties
+
+static u8 g_aiSchedulerPhase;  // staggers new schedules
+
+// public functions
+
+void initAIScheduler() {
+  HOT_DATA.aiBudget = AI_SCHEDULER_BUDGET;
+  g_aiSchedulerPhase = 0;
+}
+
+void updateAIScheduler() {
+  HOT_DATA.aiBudget = AI_SCHEDULER_BUDGET;
+}
+
+void setUpAISchedule(AISchedule* _schedule, u8 _interval) {
+  assert(_interval > 0, "AI schedule interval must be at least a frame");
+
+  _schedule->interval = _interval;
+  _schedule->countdown = g_aiSchedulerPhase % _interval;
+
+  g_aiSchedulerPhase++;
+}
+
+bool runAISchedule(AISchedule* _schedule, const Actor* _actor) {
+  if (_schedule->countdown > 0) {
+    _schedule->countdown--;
+
+    return FALSE;
+  }
+
+  // out of budget, try again next frame
+  if (HOT_DATA.aiBudget == 0) {
+    return FALSE;
+  }
+
+  // stretched in a u16 so long intervals saturate instead of wrapping
+  u16 interval = _schedule->interval;
+
+  if (!isActorOnScreen(_actor)) {
+    interval = interval * AI_SCHEDULER_OFF_SCREEN_FACTOR;
+  }
+
+  if (isGovernorLevelAtLeast(GOVERNOR_LEVEL_REDUCED)) {
+    interval = interval * 2;
+  }
+
+  _schedule->countdown = min(interval, AI_SCHEDULER_INTERVAL_MAX) - 1;
+
+  HOT_DATA.aiBudget--;
+
+  return TRUE;
+}
@@ -0,0 +1,241 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <genesis.h>
+
+#include "arena.h"
+#include "assert.h"
+#include "log.h"
+
+// constants
+
+#ifndef ARENA_SIZE
+#define ARENA_SIZE 8192  // bytes, host benchmarks raise it for wider pointers
+#endif
+
+#define ARENA_FREE_LISTS 8  // record sizes that can be recycled at once
+
+#ifdef DEBUG
+static const char* const k_arenaTagNames[] = {"actors", "player", "enemies"};
+#endif
+
+// entity
+
+struct _ArenaBlock;
+typedef struct _ArenaBlock ArenaBlock;
+
+// overlaid on a freed record while it waits to be handed out again
+struct _ArenaBlock {
+  ArenaBlock* next;
+};
+
+// global properties
+
+// words keep every allocation aligned for the 68000
+static u16 g_arenaMemory[ARENA_SIZE / sizeof(u16)];
+static u16 g_arenaUsed;      // bytes, bumped up to
+static u16 g_arenaRecycled;  // bytes, waiting on the free lists
+
+// records only ever come in a handful of fixed sizes, one list per size
+static u16 g_arenaFreeSizes[ARENA_FREE_LISTS];  // bytes, 0 when unclaimed
+static ArenaBlock* g_arenaFreeLists[ARENA_FREE_LISTS];
+
+#ifdef DEBUG
+static u16 g_arenaAllocations;
+static u16 g_arenaReuses;
+static u16 g_arenaTagBytes[ARENA_TAG_COUNT];
+static u16 g_arenaHighWater;       // bytes, survives resets
+static u16 g_arenaShownUsed;       // bytes
+static u16 g_arenaShownHighWater;  // bytes
+#endif
+
+// private functions
+
+static u16 getBlockSize(u16 _size) {
+  const u16 size = (_size + 1) & ~1;
+
+  return max(size, sizeof(ArenaBlock));
+}
+
+static s8 findFreeList(u16 _size) {
+  for (u8 i = 0; i < ARENA_FREE_LISTS; i++) {
+    if (g_arenaFreeSizes[i] == _size) {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+// public functions
+
+void initArena() {
+  g_arenaUsed = 0;
+
+#ifdef DEBUG
+  g_arenaHighWater = 0;
+#endif
+
+  setUpArena();
+}
+
+void setUpArena() {
+  g_arenaUsed = 0;
+  g_arenaRecycled = 0;
+
+  memset(g_arenaFreeSizes, 0, sizeof(g_arenaFreeSizes));
+  memset(g_arenaFreeLists, 0, sizeof(g_arenaFreeLists));
+
+#ifdef DEBUG
+  g_arenaAllocations = 0;
+  g_arenaReuses = 0;
+  g_arenaShownUsed = 0xFFFF;  // forces a redraw
+  g_arenaShownHighWater = 0xFFFF;
+
+  memset(g_arenaTagBytes, 0, sizeof(g_arenaTagBytes));
+#endif
+}
+
+void tearDownArena() {
+#ifdef DEBUG
+  log("arena: %u allocations, %u reused, %u/%u bytes, high water %u bytes",
+      g_arenaAllocations, g_arenaReuses, g_arenaUsed, ARENA_SIZE,
+      g_arenaHighWater);
+
+  for (u8 i = 0; i < ARENA_TAG_COUNT; i++) {
+    log("arena: %s %u bytes", k_arenaTagNames[i], g_arenaTagBytes[i]);
+  }
+
+  log("arena: heap %u bytes free", MEM_getFree());
+#endif
+
+  // whatever is left, recycled or not, goes with the scene
+  setUpArena();
+}
+
+void* allocateArena(u16 _size, ArenaTag _tag) {
+  const u16 size = getBlockSize(_size);
+  const s8 list = findFreeList(size);
+  void* memory;
+
+  assert(_tag < ARENA_TAG_COUNT, "Unknown arena tag");
+
+  if (list >= 0 && g_arenaFreeLists[list] != NULL) {
+    ArenaBlock* block = g_arenaFreeLists[list];
+
+    g_arenaFreeLists[list] = block->next;
+    g_arenaRecycled -= size;
+    memory = block;
+
+#ifdef DEBUG
+    g_arenaReuses++;
+#endif
+  } else {
+    // callers cope with running out, DEBUG builds stop so it gets noticed
+    assert(size <= ARENA_SIZE - g_arenaUsed, "Arena out of memory");
+
+    if (size > ARENA_SIZE - g_arenaUsed) {
+      return NULL;
+    }
+
+    memory = (u8*)g_arenaMemory + g_arenaUsed;
+    g_arenaUsed += size;
+  }
+
+#ifdef DEBUG
+  g_arenaAllocations++;
+  g_arenaTagBytes[_tag] += size;
+
+  if (g_arenaUsed > g_arenaHighWater) {
+    g_arenaHighWater = g_arenaUsed;
+  }
+#endif
+
+  return memory;
+}
+
+void freeArena(void* _memory, u16 _size, ArenaTag _tag) {
+  if (_memory == NULL) {
+    return;
+  }
+
+  const u16 size = getBlockSize(_size);
+  s8 list = findFreeList(size);
+
+  if (list < 0) {
+    list = findFreeList(0);
+
+    // out of lists the record is only lost until the scene is torn down
+    assert(list >= 0, "Arena out of free lists");
+
+    if (list < 0) {
+      return;
+    }
+
+    g_arenaFreeSizes[list] = size;
+  }
+
+  ArenaBlock* block = (ArenaBlock*)_memory;
+
+  block->next = g_arenaFreeLists[list];
+  g_arenaFreeLists[list] = block;
+  g_arenaRecycled += size;
+
+#ifdef DEBUG
+  g_arenaTagBytes[_tag] -= size;
+#endif
+}
+
+u16 getArenaUsed() {
+  return g_arenaUsed - g_arenaRecycled;
+}
+
+u16 getArenaFree() {
+  return ARENA_SIZE - getArenaUsed();
+}
+
+u16 getArenaRecycled() {
+  return g_arenaRecycled;
+}
+
+u16 getArenaReserved() {
+  return g_arenaUsed;
+}
+
+void showArenaUsage(u16 _x, u16 _y) {
+#ifdef DEBUG
+  const u16 used = getArenaUsed();
+
+  if (used == g_arenaShownUsed &&
+      g_arenaHighWater == g_arenaShownHighWater) {
+    return;
+  }
+
+  char text[16];
+
+  sprintf(text, "M%5u H%5u", used, g_arenaHighWater);
+  VDP_drawText(text, _x, _y);
+
+  g_arenaShownUsed = used;
+  g_arenaShownHighWater = g_arenaHighWater;
+#endif
+}
@@ -0,0 +1,108 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <genesis.h>
+
+#include "assert.h"
+#include "audio.h"
+#include "sounds.h"
+#include "trace.h"
+
+// constants
+
+#define AUDIO_QUEUE_SIZE 16  // commands, must be a power of two
+#define AUDIO_QUEUE_MASK (AUDIO_QUEUE_SIZE - 1)
+#define AUDIO_PLAYS_MAX 3  // sound effects handed to the driver per frame
+
+typedef struct {
+  const u8* sample;
+  u32 length;   // bytes
+  u8 priority;  // 0 to 15, higher wins a channel on the Z80
+} SoundEffectDefinition;
+
+static const SoundEffectDefinition k_soundEffects[] = {
+  {k_explosionSound, sizeof(k_explosionSound), 6},  // explosion
+  {k_hitSound, sizeof(k_hitSound), 12}              // hit
+};
+
+// global properties
+
+// gameplay only ever writes the head and the frame update only ever moves the
+// tail so posting never has to wait on anything
+static u8 g_audioQueue[AUDIO_QUEUE_SIZE];
+static u8 g_audioQueueHead;  // next command to write
+static u8 g_audioQueueTail;  // next command to read
+
+// public functions
+
+void initAudio() {
+  // the driver mixes and picks channels on the Z80, the 68000 only tells it
+  // what to start
+  Z80_loadDriver(Z80_DRIVER_XGM2, TRUE);
+
+  g_audioQueueHead = 0;
+  g_audioQueueTail = 0;
+}
+
+void updateAudio() {
+  u16 requested = 0;  // one bit per sound effect
+
+  // repeats within a frame collapse into a single play
+  while (g_audioQueueTail != g_audioQueueHead) {
+    requested |= 1 << g_audioQueue[g_audioQueueTail];
+
+    g_audioQueueTail = (g_audioQueueTail + 1) & AUDIO_QUEUE_MASK;
+  }
+
+  // every play is a Z80 bus request so a busy frame is capped, the driver
+  // steals channels by priority so it's fine to hand it anything
+  u8 plays = 0;
+
+  for (u8 i = 0; i < SOUND_EFFECT_COUNT && plays < AUDIO_PLAYS_MAX; i++) {
+    if (!(requested & (1 << i))) {
+      continue;
+    }
+
+    const SoundEffectDefinition* effect = &k_soundEffects[i];
+
+    XGM2_playPCMEx(effect->sample, effect->length, SOUND_PCM_CH_AUTO,
+                   effect->priority, FALSE, FALSE);
+
+    plays++;
+  }
+}
+
+void playSoundEffect(SoundEffect _effect) {
+  assert(_effect < SOUND_EFFECT_COUNT, "Unknown sound effect");
+
+  const u8 head = (g_audioQueueHead + 1) & AUDIO_QUEUE_MASK;
+
+  // a full queue drops the command rather than stall the frame
+  if (head == g_audioQueueTail) {
+    trace(TRACE_EVENT_SOUND_DROPPED, _effect, 0);
+
+    return;
+  }
+
+  g_audioQueue[g_audioQueueHead] = _effect;
+  g_audioQueueHead = head;
+}
@@ -24,22 +24,39 @@
 
 #include "actor.h"
 #include "camera.h"
+#include "hot_data.h"
 #include "stage.h"
 #include "utilities.h"
 
-// global properties
+// private functions
 
-static V2f32 g_cameraOffset;
+static void updateView(Camera* _camera, V2s32 _origin) {
+  const V2s32 minimum = {
+    F32_toRoundedInt(_camera->position.x),  // x
+    F32_toRoundedInt(_camera->position.y)   // y
+  };
+  const V2s32 maximum = {
+    minimum.x + VDP_getScreenWidth(),  // x
+    minimum.y + VDP_getScreenHeight()  // y
+  };
+
+  _camera->view.minimum = minimum;
+  _camera->view.maximum = maximum;
+  _camera->view.localMinimum.x = minimum.x - _origin.x;
+  _camera->view.localMinimum.y = minimum.y - _origin.y;
+  _camera->view.localMaximum.x = maximum.x - _origin.x;
+  _camera->view.localMaximum.y = maximum.y - _origin.y;
+}
 
 // public functions
 
 void initCamera() {
-  g_cameraOffset.x = FIX32(VDP_getScreenWidth() / 2);
-  g_cameraOffset.y = FIX32(VDP_getScreenHeight() / 2);
+  HOT_DATA.cameraOffset.x = FIX32(VDP_getScreenWidth() / 2);
+  HOT_DATA.cameraOffset.y = FIX32(VDP_getScreenHeight() / 2);
 }
 
 void setUpCamera(Camera* _camera, CameraPositionCallback _positionCallback,
-                 bool _evaluateCallback) {
+                 bool _evaluateCallback, V2s32 _origin) {
   V2f32 position;
 
   if (_positionCallback != NULL && _evaluateCallback) {
@@ -51,9 +68,11 @@ void setUpCamera(Camera* _camera, CameraPositionCallback _positionCallback,
 
   _camera->positionCallback = _positionCallback;
   _camera->position = position;
+
+  updateView(_camera, _origin);
 }
 
-void updateCamera(Camera* _camera) {
+void updateCamera(Camera* _camera, V2s32 _origin) {
   CameraPositionCallback positionCallback = _camera->positionCallback;
 
   if (positionCallback == NULL) {
@@ -62,11 +81,13 @@ void updateCamera(Camera* _camera) {
 
   const V2f32 newPosition = positionCallback();
   const V2f32 position = {
-    newPosition.x - g_cameraOffset.x,  // x
-    newPosition.y - g_cameraOffset.y   // y
+    newPosition.x - HOT_DATA.cameraOffset.x,  // x
+    newPosition.y - HOT_DATA.cameraOffset.y   // y
   };
 
   _camera->position = position;
+
+  updateView(_camera, _origin);
 }
 
 void tearDownCamera(Camera* _camera) {
@@ -74,10 +95,9 @@ void tearDownCamera(Camera* _camera) {
 }
 
 V2s32 getCameraPositionRounded(const Camera* _camera) {
-  const V2s32 positionRounded = {
-    F32_toRoundedInt(_camera->position.x),  // x
-    F32_toRoundedInt(_camera->position.y)   // y
-  };
+  return _camera->view.minimum;
+}
 
-  return positionRounded;
+const CameraView* getCameraView(const Camera* _camera) {
+  return &_camera->view;
 }
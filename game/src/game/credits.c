@@ -23,12 +23,13 @@
 #include <genesis.h>
 
 #include "game.h"
+#include "input.h"
 #include "utilities.h"
 
 // private functions
 
 static void setUpGameCredits() {
-  JOY_setEventHandler(NULL);
+  setInputEventHandler(NULL);
   VDP_resetScreen();
   PAL_setColor(0, RGB24_TO_VDPCOLOR(0x000000));
 }
@@ -23,12 +23,13 @@
 #include <genesis.h>
 
 #include "game.h"
+#include "input.h"
 #include "utilities.h"
 
 // private functions
 
 static void setUpGameLogo() {
-  JOY_setEventHandler(NULL);
+  setInputEventHandler(NULL);
   VDP_resetScreen();
 }
 
@@ -23,6 +23,7 @@
 #include <genesis.h>
 
 #include "game.h"
+#include "input.h"
 #include "sprites.h"
 #include "utilities.h"
 
@@ -71,7 +72,7 @@ static void doFlash() {
 }
 
 static void setUpGameMenu() {
-  JOY_setEventHandler(NULL);
+  setInputEventHandler(NULL);
   VDP_resetScreen();
 }
 
@@ -105,7 +106,7 @@ void processGameMenu() {
   SPR_setPosition(title, titlePositionX, LOGO_END_POSITION_Y);
   doFlash();
   showText("PRESS START BUTTON", 16);
-  JOY_setEventHandler(&joyHandlerMenu);
+  setInputEventHandler(&joyHandlerMenu);
 
   g_runMenuExit = FALSE;
 
@@ -115,7 +116,7 @@ void processGameMenu() {
   }
 
   clearText(16);
-  JOY_setEventHandler(NULL);
+  setInputEventHandler(NULL);
   doFlash();
   PAL_fadeOutPalette(PAL1, secondsToFrames(LOGO_FADE_OUT_TIME), TRUE);
 
@@ -23,26 +23,56 @@
 #include <genesis.h>
 
 #include "actor.h"
+#include "actors/enemies/boss.h"
 #include "actors/enemies/homing_mine.h"
 #include "actors/enemies/mine.h"
+#include "actors/enemies/mine_formation.h"
+#include "actors/enemies/scripted_mine.h"
 #include "actors/player.h"
+#include "ai_scheduler.h"
+#include "arena.h"
+#include "audio.h"
 #include "camera.h"
 #include "game.h"
+#include "governor.h"
+#include "hot_data.h"
+#include "hud.h"
+#include "input.h"
 #include "managed_actor.h"
 #include "maps.h"
+#include "particles.h"
+#include "paths.h"
+#include "scanlines.h"
+#include "scripts.h"
 #include "sprites.h"
 #include "stage.h"
+#include "trace.h"
 #include "utilities.h"
 
+// constants
+
+#define PLAY_MULTIPLIER_MAX 9
+#define PLAY_MULTIPLIER_INTERVAL 10  // seconds without getting hit
+#define PLAY_DEBUG_FIRST_ROW 1       // tiles, right under the hud
+#define PLAY_DEBUG_ROWS 4            // tiles
+
+static const u16 k_playMultiplierIntervals[] = {
+  NTSC_SECONDS_TO_FRAMES(PLAY_MULTIPLIER_INTERVAL),  // ntsc
+  PAL_SECONDS_TO_FRAMES(PLAY_MULTIPLIER_INTERVAL)    // pal
+};
+
 // global entities
 
-static Stage g_stage;
 static Camera g_camera;
 static Actor* g_player = NULL;
 
 // global properties
 
 static bool g_paused;
+static u32 g_score;
+static u8 g_multiplier;
+static u16 g_multiplierTimer;  // frames until the multiplier goes up
+static u8 g_health;            // last shown
 
 // private functions
 
@@ -57,20 +87,33 @@ static void joyHandlerGamePlay(u16 _joy, u16 _changed, u16 _state) {
 }
 
 static V2f32 cameraPositionCallback() {
-  const f32 playerPositionY = getActorPositionY(g_player);
+  const Stage* stage = &HOT_DATA.stage;
+  const V2f16 playerPosition = getActorPosition(g_player);
+  const f32 playerPositionY = getStageWorldPosition(stage, playerPosition).y;
   const f32 halfScreenHeight = FIX32(VDP_getScreenHeight() / 2);
   const f32 minimumY = halfScreenHeight;
-  const f32 maximumY = FIX32(g_stage.height) - halfScreenHeight;
+  const f32 maximumY = FIX32(stage->height) - halfScreenHeight;
   const V2f32 position = {
-    F32_avg(g_stage.minimumX, g_stage.maximumX),  // x
-    clamp(playerPositionY, minimumY, maximumY)    // y
+    F32_avg(stage->minimumX, stage->maximumX),  // x
+    clamp(playerPositionY, minimumY, maximumY)  // y
   };
 
   return position;
 }
 
-static void setUpActors(const Stage* _stage, u16 _palette) {
-  g_player = createPlayer(PAL2, _stage->startPosition);
+static void setUpActors(const Stage* _stage, u16 _palette, u16 _tileIndex) {
+  const V2f16 playerPosition =
+    getStageLocalPosition(_stage, _stage->startPosition);
+
+  g_player = createPlayer(PAL2, playerPosition);
+
+  // the arena is empty at this point, so this is a sizing mistake
+  if (g_player == NULL) {
+    SYS_die("setUpActors", "Failed to create player");
+  }
+
+  // enemies hold a handle so they can never reach a player that's gone
+  const ActorHandle player = getActorHandle(g_player);
 
   const V2f32 mine1Position = {
     _stage->startPosition.x + FIX32(200),  // x
@@ -85,56 +128,194 @@ static void setUpActors(const Stage* _stage, u16 _palette) {
     _stage->startPosition.y - FIX32(100)   // y
   };
 
-  createMine(_palette, mine1Position, g_player);
-  createHomingMine(_palette, mine2Position, g_player);
-  createHomingMine(_palette, mine3Position, g_player);
+  createMine(_palette, getStageLocalPosition(_stage, mine1Position),
+             k_wavePaths, player);
+  createHomingMine(_palette, getStageLocalPosition(_stage, mine2Position),
+                   player);
+  createHomingMine(_palette, getStageLocalPosition(_stage, mine3Position),
+                   player);
+
+  const V2f32 drifterPosition = {
+    _stage->startPosition.x + FIX32(360),  // x
+    _stage->startPosition.y - FIX32(40)    // y
+  };
+
+  createScriptedMine(_palette, getStageLocalPosition(_stage, drifterPosition),
+                     k_drifterScripts, player);
+
+  const V2f32 formationPosition = {
+    _stage->startPosition.x + FIX32(480),  // x
+    _stage->startPosition.y                // y
+  };
+
+  createMineFormation(_palette,
+                      getStageLocalPosition(_stage, formationPosition),
+                      MINE_FORMATION_SHAPE_VEE, k_wavePaths, player);
+
+  const V2f32 bossPosition = {
+    _stage->startPosition.x + FIX32(500),  // x
+    _stage->startPosition.y                // y
+  };
+
+  createBoss(_palette, _tileIndex, getStageLocalPosition(_stage, bossPosition),
+             player);
 }
 
 static void updateActors(const Stage* _stage) {
+  updateParticles(_stage);
   updateActor(g_player, _stage);
   updateManagedActors(_stage);
 }
 
 static void drawActors(const Camera* _camera) {
   drawManagedActors(_camera);
-  drawActor(g_player, _camera);
+  projectActor(g_player, getCameraView(_camera));
+  drawActor(g_player);
+  drawParticles(_camera);
 }
 
 static void tearDownActors() {
   destroyManagedActors();
   destroyActor(g_player);
+  tearDownParticles();
 
   g_player = NULL;
 }
 
+static void setUpScore() {
+  g_score = 0;
+  g_multiplier = 1;
+  g_multiplierTimer = k_playMultiplierIntervals[getFrameRateIndex()];
+  g_health = getPlayerHealth(g_player);
+
+  setUpHud();
+  setHudHealth(g_health);
+}
+
+static void updateScore() {
+  const u8 health = getPlayerHealth(g_player);
+
+  // getting hit throws the multiplier away, surviving builds it back up
+  if (health < g_health) {
+    g_multiplier = 1;
+    g_multiplierTimer = k_playMultiplierIntervals[getFrameRateIndex()];
+
+    setHudMultiplier(g_multiplier);
+  } else if (g_multiplier < PLAY_MULTIPLIER_MAX) {
+    g_multiplierTimer--;
+
+    if (g_multiplierTimer == 0) {
+      g_multiplier++;
+      g_multiplierTimer = k_playMultiplierIntervals[getFrameRateIndex()];
+
+      setHudMultiplier(g_multiplier);
+    }
+  }
+
+  if (health != g_health) {
+    g_health = health;
+
+    setHudHealth(health);
+  }
+
+  g_score += g_multiplier;
+
+  setHudScore(g_score);
+}
+
+#ifdef DEBUG
+// the boss scrolls all of BG_A, so the readouts go in the window next to the
+// hud where nothing can move or overwrite them
+static void setUpDebugText() {
+  VDP_clearTileMapRect(WINDOW, 0, PLAY_DEBUG_FIRST_ROW,
+                       VDP_getScreenWidth() / 8, PLAY_DEBUG_ROWS);
+  VDP_setWindowVPos(FALSE, PLAY_DEBUG_FIRST_ROW + PLAY_DEBUG_ROWS);
+  VDP_setTextPlane(WINDOW);
+  setParticleTilesFirstRow(PLAY_DEBUG_FIRST_ROW + PLAY_DEBUG_ROWS);
+}
+
+static void tearDownDebugText() {
+  VDP_setTextPlane(BG_A);
+  VDP_clearTileMapRect(WINDOW, 0, PLAY_DEBUG_FIRST_ROW,
+                       VDP_getScreenWidth() / 8, PLAY_DEBUG_ROWS);
+}
+#endif
+
 static void setUpGamePlay() {
-  JOY_setEventHandler(&joyHandlerGamePlay);
+  setInputEventHandler(&joyHandlerGamePlay);
   VDP_resetScreen();
+  setUpArena();
   PAL_setPalette(PAL1, k_stage1Palette.data, DMA);
   PAL_setPalette(PAL2, k_primarySpritePalette.data, DMA);
-  setUpStage(&g_stage, PAL1);
-  setUpActors(&g_stage, PAL2);
-  setUpCamera(&g_camera, &cameraPositionCallback, TRUE);
+  setUpStage(&HOT_DATA.stage, PAL1);
+
+  const u16 tileIndex = setUpParticles(PAL2, HOT_DATA.stage.tileIndex);
+
+  setUpActors(&HOT_DATA.stage, PAL2, tileIndex);
+  setUpCamera(&g_camera, &cameraPositionCallback, TRUE, HOT_DATA.stage.origin);
+  setUpScore();
+  setParticleTilesFirstRow(getHudRows());
+
+#ifdef DEBUG
+  setUpDebugText();
+#endif
+
+  setUpScanlines();
+  setUpGovernor();
+  resetFrameTicks();
 
   g_paused = FALSE;
 }
 
+static void stepGamePlay() {
+  updateStage(&HOT_DATA.stage);
+  updateActors(&HOT_DATA.stage);
+  updateCamera(&g_camera, HOT_DATA.stage.origin);
+  updateScore();
+
+  if (isPlayerDead(g_player)) {
+    setGameState(STATE_CREDITS);
+  }
+}
+
 static void updateGamePlay() {
-  SPR_update();
+  // sprite state can only change while running so a paused frame has nothing
+  // new to upload
+  if (!g_paused) {
+    SPR_update();
+  }
+
+  updateGovernor();
+  updateHud();
+  updateAudio();
 
 #ifdef DEBUG
   VDP_showFPS(FALSE, 1, 1);
   VDP_showCPULoad(1, 2);
+  showGovernorLevel(1, 3);
+  showArenaUsage(1, 4);
+  showScanlines(g_player);
 #endif
 
   SYS_doVBlankProcess();
 }
 
 static void tearDownGamePlay() {
-  JOY_setEventHandler(NULL);
+  setInputEventHandler(NULL);
+
+  g_paused = FALSE;  // make sure released sprites get flushed
+
+  tearDownScanlines();
+
+#ifdef DEBUG
+  tearDownDebugText();
+#endif
+
+  tearDownHud();
   tearDownCamera(&g_camera);
   tearDownActors();
-  tearDownStage(&g_stage);
+  tearDownStage(&HOT_DATA.stage);
+  tearDownArena();
   updateGamePlay();
 }
 
@@ -144,20 +325,36 @@ void processGamePlay() {
   setUpGamePlay();
 
   while (isGameState(STATE_PLAY)) {
+    // lag frames are paid back with extra simulation ticks so the game keeps
+    // its speed instead of dropping into slow motion
+    u8 ticks = getFrameTicks();
+
+    if (ticks > 1) {
+      trace(TRACE_EVENT_LAG, ticks, 0);
+    }
+
     if (!g_paused) {
-      updateStage(&g_stage);
-      updateActors(&g_stage);
-      updateCamera(&g_camera);
+      // catch up ticks share one frame's worth of decisions and particle
+      // spawns, they are what made the frame late in the first place
+      updateAIScheduler();
+      resetParticleSpawnBudget();
+
+      while (ticks > 0 && isGameState(STATE_PLAY)) {
+        stepGamePlay();
 
-      if (isPlayerDead(g_player)) {
-        setGameState(STATE_CREDITS);
+        ticks--;
       }
+
+      drawStage(&HOT_DATA.stage, &g_camera);
+      drawActors(&g_camera);
     }
 
-    drawStage(&g_stage, &g_camera);
-    drawActors(&g_camera);
     updateGamePlay();
   }
 
   tearDownGamePlay();
 }
+
+bool isGamePlayPaused() {
+  return g_paused;
+}
@@ -0,0 +1,118 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <genesis.h>
+
+#include "governor.h"
+#include "trace.h"
+
+// constants
+
+#define GOVERNOR_LOAD_HIGH 90        // percent
+#define GOVERNOR_LOAD_LOW 70         // percent
+#define GOVERNOR_LOAD_OVERRUN 100    // percent
+#define GOVERNOR_STEP_DOWN_FRAMES 2  // frames
+#define GOVERNOR_STEP_UP_FRAMES 60   // frames
+
+// global properties
+
+static GovernorLevel g_governorLevel;
+static GovernorLevel g_governorShownLevel;
+static u8 g_governorHighFrames;  // consecutive frames over the high mark
+static u8 g_governorLowFrames;   // consecutive frames under the low mark
+
+// public functions
+
+void initGovernor() {
+  setUpGovernor();
+}
+
+void setUpGovernor() {
+  g_governorLevel = GOVERNOR_LEVEL_FULL;
+  g_governorShownLevel = GOVERNOR_LEVEL_COUNT;  // forces a redraw
+  g_governorHighFrames = 0;
+  g_governorLowFrames = 0;
+}
+
+void updateGovernor() {
+  const u16 load = SYS_getCPULoad();
+  GovernorLevel level = g_governorLevel;
+
+  // the gap between the high and low marks plus the longer wait to step back
+  // up keeps the level from flapping around the budget
+  if (load >= GOVERNOR_LOAD_HIGH) {
+    g_governorLowFrames = 0;
+    g_governorHighFrames++;
+
+    // a lag frame already happened so don't wait around
+    if (load >= GOVERNOR_LOAD_OVERRUN ||
+        g_governorHighFrames >= GOVERNOR_STEP_DOWN_FRAMES) {
+      if (level < GOVERNOR_LEVEL_COUNT - 1) {
+        level++;
+      }
+
+      g_governorHighFrames = 0;
+    }
+  } else if (load <= GOVERNOR_LOAD_LOW) {
+    g_governorHighFrames = 0;
+    g_governorLowFrames++;
+
+    if (g_governorLowFrames >= GOVERNOR_STEP_UP_FRAMES) {
+      if (level > GOVERNOR_LEVEL_FULL) {
+        level--;
+      }
+
+      g_governorLowFrames = 0;
+    }
+  } else {
+    g_governorHighFrames = 0;
+    g_governorLowFrames = 0;
+  }
+
+  if (level != g_governorLevel) {
+    trace(TRACE_EVENT_GOVERNOR, g_governorLevel, level);
+  }
+
+  g_governorLevel = level;
+}
+
+GovernorLevel getGovernorLevel() {
+  return g_governorLevel;
+}
+
+bool isGovernorLevelAtLeast(GovernorLevel _level) {
+  return g_governorLevel >= _level;
+}
+
+void showGovernorLevel(u16 _x, u16 _y) {
+  const GovernorLevel level = g_governorLevel;
+
+  if (level == g_governorShownLevel) {
+    return;
+  }
+
+  char text[3] = {'G', '0' + level, '\0'};
+
+  VDP_drawText(text, _x, _y);
+
+  g_governorShownLevel = level;
+}
@@ -0,0 +1,96 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <genesis.h>
+
+#include "assert.h"
+#include "hitbox.h"
+#include "tile_mask.h"
+
+// public functions
+
+const Hitbox* getHitbox(const HitboxSheet* _sheet, u8 _animation, u8 _frame,
+                        bool _flipped) {
+  const u16 index = _animation * _sheet->columns + _frame;
+
+  assert(_frame < _sheet->columns && index < _sheet->count,
+         "Hitbox frame out of range");
+
+  return &_sheet->hitboxes[_flipped ? index + _sheet->count : index];
+}
+
+bool isHitboxOverlapping(const Hitbox* _hitbox1, V2f16 _position1,
+                         const Hitbox* _hitbox2, V2f16 _position2) {
+  const s16 deltaX = F16_toInt(_position2.x) - F16_toInt(_position1.x);
+  const s16 deltaY = F16_toInt(_position2.y) - F16_toInt(_position1.y);
+  const s16 reach = _hitbox1->radius + _hitbox2->radius;
+
+  // the baked radius rejects almost every pair before any box is looked at
+  if (abs(deltaX) > reach || abs(deltaY) > reach) {
+    return FALSE;
+  }
+
+  const HitboxBox* box1 = _hitbox1->boxes;
+
+  for (u8 i = 0; i < _hitbox1->count; i++, box1++) {
+    const HitboxBox* box2 = _hitbox2->boxes;
+
+    for (u8 j = 0; j < _hitbox2->count; j++, box2++) {
+      const s16 x2 = deltaX + box2->x;
+      const s16 y2 = deltaY + box2->y;
+
+      if (box1->x < x2 + box2->width && x2 < box1->x + box1->width &&
+          box1->y < y2 + box2->height && y2 < box1->y + box1->height) {
+        return TRUE;
+      }
+    }
+  }
+
+  return FALSE;
+}
+
+bool isHitboxOverlappingTileMask(const Hitbox* _hitbox, V2f16 _position,
+                                 const TileMask* _mask, V2s16 _maskPosition) {
+  // boxes are moved into the space of the mask, its top left being 0, 0
+  const s16 x = F16_toInt(_position.x) - _maskPosition.x;
+  const s16 y = F16_toInt(_position.y) - _maskPosition.y;
+  const s16 reach = _hitbox->radius;
+
+  if (x + reach < 0 || y + reach < 0 || x - reach >= _mask->columns * 8 ||
+      y - reach >= _mask->rows * 8) {
+    return FALSE;
+  }
+
+  const HitboxBox* box = _hitbox->boxes;
+
+  for (u8 i = 0; i < _hitbox->count; i++, box++) {
+    const s16 left = x + box->x;
+    const s16 top = y + box->y;
+
+    if (isTileMaskSolid(_mask, left, top, left + box->width - 1,
+                        top + box->height - 1)) {
+      return TRUE;
+    }
+  }
+
+  return FALSE;
+}
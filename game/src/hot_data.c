@@ -0,0 +1,86 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <genesis.h>
+
+#include "assert.h"
+#include "hot_data.h"
+
+// constants
+
+#ifdef __m68k__
+// fails to compile when a new member pushes the struct out of its block
+typedef char HotDataFits[sizeof(HotData) <= HOT_DATA_SIZE ? 1 : -1];
+#endif
+
+// global properties
+
+#ifdef __m68k__
+// moves the stack, and the initial stack pointer in the vector table, down
+// out of the way of the block, must match HOT_DATA_START
+__asm__(".global __stack\n.set __stack, 0x00FFFF00");
+
+extern u8 __stack;
+
+// SGDK still ends the heap a fixed stack size below the top of RAM, which
+// now overlaps the bottom of the moved stack by the size of the block
+static void* g_hotDataHeapReserve;
+#else
+HotData g_hotData;
+#endif
+
+// private functions
+
+#ifdef __m68k__
+static void reserveHeapTop() {
+  // allocation is first fit from the bottom, so filling the largest block
+  // up to the reserve leaves only the top of the heap to hand out next
+  const u16 largest = MEM_getLargestFreeBlock();
+
+  assert(largest > HOT_DATA_SIZE * 2, "Heap too small for the reserve");
+
+  void* below = MEM_alloc(largest - HOT_DATA_SIZE - sizeof(u16));
+
+  g_hotDataHeapReserve = MEM_alloc(MEM_getLargestFreeBlock());
+  MEM_free(below);
+
+  assert((u8*)g_hotDataHeapReserve > (u8*)below,
+         "Heap reserve is not at the top");
+}
+#endif
+
+// public functions
+
+void initHotData(bool _hardReset) {
+#ifdef __m68k__
+  assert((u32)&__stack <= HOT_DATA_START, "Stack overlaps hot data");
+
+  // SGDK sets the heap up again on every reset
+  reserveHeapTop();
+#endif
+
+  // nothing clears the block at power on the way it does for .bss, a soft
+  // reset leaves it alone like any other static
+  if (_hardReset) {
+    memset(&HOT_DATA, 0, sizeof(HotData));
+  }
+}
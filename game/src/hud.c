@@ -0,0 +1,159 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <genesis.h>
+
+#include "hud.h"
+
+// constants
+
+#define HUD_ROWS 1                // tiles, shown at the top of the screen
+#define HUD_COLUMNS 40            // tiles
+#define HUD_SCORE_COLUMN 7        // tiles
+#define HUD_HEALTH_COLUMN 19      // tiles
+#define HUD_MULTIPLIER_COLUMN 32  // tiles
+#define HUD_SCORE_DIGITS 6
+#define HUD_HEALTH_DIGITS 2
+#define HUD_MULTIPLIER_DIGITS 2
+#define HUD_POWERS 6
+#define HUD_DIRTY_NONE 0xFF
+
+static const u32 k_hudPowers[HUD_POWERS] = {100000, 10000, 1000, 100, 10, 1};
+
+// global properties
+
+static u16 g_hudTiles[HUD_COLUMNS];  // mirror of the window row
+static u8 g_hudDirtyFirst;           // tiles, first column to upload
+static u8 g_hudDirtyLast;            // tiles, last column to upload
+
+// private functions
+
+static u16 getCharacterTile(char _character) {
+  return TILE_ATTR_FULL(PAL0, TRUE, FALSE, FALSE,
+                        TILE_FONT_INDEX + _character - ' ');
+}
+
+static void setTile(u8 _column, u16 _tile) {
+  if (g_hudTiles[_column] == _tile) {
+    return;
+  }
+
+  g_hudTiles[_column] = _tile;
+
+  if (g_hudDirtyFirst == HUD_DIRTY_NONE || _column < g_hudDirtyFirst) {
+    g_hudDirtyFirst = _column;
+  }
+
+  if (g_hudDirtyLast == HUD_DIRTY_NONE || _column > g_hudDirtyLast) {
+    g_hudDirtyLast = _column;
+  }
+}
+
+static void drawLabel(u8 _column, const char* _text) {
+  while (*_text != '\0') {
+    setTile(_column, getCharacterTile(*_text));
+
+    _column++;
+    _text++;
+  }
+}
+
+static void drawNumber(u8 _column, u32 _value, u8 _digits) {
+  const u32* power = &k_hudPowers[HUD_POWERS - _digits];
+  u32 value = min(_value, power[0] * 10 - 1);
+
+  // the 68000 can't divide 32 bits so digits are peeled off by subtracting,
+  // at most nine times each
+  for (u8 i = 0; i < _digits; i++, power++) {
+    char digit = '0';
+
+    while (value >= *power) {
+      value -= *power;
+      digit++;
+    }
+
+    setTile(_column + i, getCharacterTile(digit));
+  }
+}
+
+// public functions
+
+void initHud() {
+  g_hudDirtyFirst = HUD_DIRTY_NONE;
+  g_hudDirtyLast = HUD_DIRTY_NONE;
+}
+
+void setUpHud() {
+  memset(g_hudTiles, 0, sizeof(g_hudTiles));
+
+  // the first upload covers the whole row so nothing stale is left behind
+  g_hudDirtyFirst = 0;
+  g_hudDirtyLast = HUD_COLUMNS - 1;
+
+  drawLabel(1, "SCORE");
+  drawLabel(HUD_HEALTH_COLUMN - 3, "HP");
+  drawLabel(HUD_MULTIPLIER_COLUMN - 1, "X");
+  drawNumber(HUD_SCORE_COLUMN, 0, HUD_SCORE_DIGITS);
+  drawNumber(HUD_HEALTH_COLUMN, 0, HUD_HEALTH_DIGITS);
+  drawNumber(HUD_MULTIPLIER_COLUMN, 1, HUD_MULTIPLIER_DIGITS);
+  VDP_setWindowVPos(FALSE, HUD_ROWS);
+}
+
+void updateHud() {
+  if (g_hudDirtyFirst == HUD_DIRTY_NONE) {
+    return;
+  }
+
+  const u8 first = g_hudDirtyFirst;
+  const u16 address = VDP_getWindowAddress() + first * sizeof(u16);
+
+  // everything that changed goes out as one transfer during the next vblank
+  DMA_queueDma(DMA_VRAM, &g_hudTiles[first], address,
+               g_hudDirtyLast - first + 1, 2);
+
+  g_hudDirtyFirst = HUD_DIRTY_NONE;
+  g_hudDirtyLast = HUD_DIRTY_NONE;
+}
+
+void tearDownHud() {
+  VDP_setWindowVPos(FALSE, 0);
+  VDP_clearTextBG(WINDOW, 0, 0, HUD_COLUMNS);
+
+  g_hudDirtyFirst = HUD_DIRTY_NONE;
+  g_hudDirtyLast = HUD_DIRTY_NONE;
+}
+
+void setHudScore(u32 _score) {
+  drawNumber(HUD_SCORE_COLUMN, _score, HUD_SCORE_DIGITS);
+}
+
+void setHudHealth(u8 _health) {
+  drawNumber(HUD_HEALTH_COLUMN, _health, HUD_HEALTH_DIGITS);
+}
+
+void setHudMultiplier(u8 _multiplier) {
+  drawNumber(HUD_MULTIPLIER_COLUMN, _multiplier, HUD_MULTIPLIER_DIGITS);
+}
+
+u16 getHudRows() {
+  return HUD_ROWS;
+}
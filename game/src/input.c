@@ -0,0 +1,252 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <genesis.h>
+
+#include "actor.h"
+#include "arena.h"
+#include "game.h"
+#include "input.h"
+#include "managed_actor.h"
+#include "stage.h"
+#include "utilities.h"
+
+#ifdef AUTOPLAY
+
+// constants
+
+#define AUTOPLAY_START_INTERVAL 60  // frames between start presses
+#define AUTOPLAY_PLAY_TIME 180      // seconds before a run is cut short
+#define AUTOPLAY_LOOKAHEAD 96       // pixels in front of the ship
+#define AUTOPLAY_LOOKBEHIND 16      // pixels behind the ship
+#define AUTOPLAY_MARGIN 8           // pixels kept between ship and enemy
+#define AUTOPLAY_DEAD_ZONE 2        // pixels
+
+// entity
+
+// everything is the worst seen since the last menu unless it says otherwise
+typedef struct {
+  u16 loop;
+  u16 playFrames;
+  u16 cpuLoad;     // percent
+  u16 frameTime;   // vblanks
+  u16 lagFrames;   // total
+  u16 sprites;
+  u16 vramFree;    // tiles, lowest
+  u16 arenaUsed;   // bytes
+} AutoplayStats;
+
+// global properties
+
+static JoyEventCallback* g_autoplayEventHandler;
+static GameState g_autoplayGameState;
+static u16 g_autoplayStateFrames;  // frames since the game state changed
+static u32 g_autoplayTimer;        // vtimer at the last vblank
+static AutoplayStats g_autoplayStats;
+
+// private functions
+
+static void resetAutoplayStats() {
+  const u16 loop = g_autoplayStats.loop;
+
+  memset(&g_autoplayStats, 0, sizeof(AutoplayStats));
+
+  g_autoplayStats.loop = loop + 1;
+  g_autoplayStats.vramFree = 0xFFFF;
+}
+
+// soaks are run on release builds so this logs whether DEBUG is on or not
+static void logAutoplayStats() {
+  const AutoplayStats* stats = &g_autoplayStats;
+
+  kprintf("autoplay: loop %u, %u s played", stats->loop,
+          stats->playFrames / getFrameRate());
+  kprintf("autoplay: heap %u free, %u largest block", MEM_getFree(),
+          MEM_getLargestFreeBlock());
+  kprintf("autoplay: sprites %u peak, %u left", stats->sprites,
+          SPR_getNumActiveSprite());
+  kprintf("autoplay: vram %u tiles free at worst, %u after", stats->vramFree,
+          SPR_getFreeVRAM());
+  kprintf("autoplay: arena %u bytes peak", stats->arenaUsed);
+  kprintf("autoplay: frame %u vblanks, %u%% cpu at worst, %u lag frames",
+          stats->frameTime, stats->cpuLoad, stats->lagFrames);
+}
+
+static void samplePlay() {
+  AutoplayStats* stats = &g_autoplayStats;
+  const u16 sprites = SPR_getNumActiveSprite();
+  const u16 vramFree = SPR_getFreeVRAM();
+  const u16 arenaUsed = getArenaUsed();
+
+  stats->playFrames++;
+  stats->sprites = max(stats->sprites, sprites);
+  stats->vramFree = min(stats->vramFree, vramFree);
+  stats->arenaUsed = max(stats->arenaUsed, arenaUsed);
+
+  // nobody dies when the bot plays well, so runs get a time limit to keep the
+  // loop going
+  if (stats->playFrames >= AUTOPLAY_PLAY_TIME * getFrameRate()) {
+    setGameState(STATE_CREDITS);
+  }
+}
+
+static void pressStart() {
+  if (g_autoplayEventHandler == NULL ||
+      g_autoplayStateFrames % AUTOPLAY_START_INTERVAL != 0) {
+    return;
+  }
+
+  g_autoplayEventHandler(JOY_1, BUTTON_START, BUTTON_START);
+  g_autoplayEventHandler(JOY_1, BUTTON_START, 0);
+}
+
+// runs once at the end of every SYS_doVBlankProcess, whatever state the game
+// is in
+static void vBlankCallbackAutoplay() {
+  const GameState state = getGameState();
+  const u32 timer = vtimer;
+  const u16 frameTime = timer - g_autoplayTimer;
+  const bool stateChanged = state != g_autoplayGameState;
+  AutoplayStats* stats = &g_autoplayStats;
+
+  g_autoplayTimer = timer;
+
+  if (stateChanged) {
+    // a loop ends when the credits hand back to the menu
+    if (g_autoplayGameState == STATE_CREDITS && state == STATE_MENU) {
+      logAutoplayStats();
+      resetAutoplayStats();
+    }
+
+    g_autoplayGameState = state;
+    g_autoplayStateFrames = 0;
+  }
+
+  g_autoplayStateFrames++;
+
+  if (state == STATE_MENU) {
+    pressStart();
+  } else if (state == STATE_PLAY && !isGamePlayPaused()) {
+    // the first frame in play also spans the stage load, which would hide
+    // any slow down building up over a run
+    if (!stateChanged) {
+      const u16 cpuLoad = SYS_getCPULoad();
+
+      stats->frameTime = max(stats->frameTime, frameTime);
+      stats->cpuLoad = max(stats->cpuLoad, cpuLoad);
+
+      if (frameTime > 1) {
+        stats->lagFrames += frameTime - 1;
+      }
+    }
+
+    samplePlay();
+  }
+}
+
+#endif
+
+// public functions
+
+void initInput() {
+#ifdef AUTOPLAY
+  // the real pad is never listened to so a soak can't be thrown off by it
+  JOY_setEventHandler(NULL);
+  SYS_setVBlankCallback(&vBlankCallbackAutoplay);
+
+  g_autoplayEventHandler = NULL;
+  g_autoplayGameState = getGameState();
+  g_autoplayStateFrames = 0;
+  g_autoplayTimer = vtimer;
+  g_autoplayStats.loop = 0;
+
+  resetAutoplayStats();
+
+  kprintf("autoplay: on");
+#endif
+}
+
+#ifdef AUTOPLAY
+u16 readAutoplayInput(const Actor* _player, const Stage* _stage) {
+  const V2f16 position = getActorPosition(_player);
+  const s16 playerX = F16_toInt(position.x);
+  const s16 playerY = F16_toInt(position.y);
+  const s16 playerExtentY = getActorExtent(_player).y;
+  const s16 minimumX = F16_toInt(_stage->localMinimum.x);
+  const s16 maximumX = F16_toInt(_stage->localMaximum.x);
+  const s16 minimumY = F16_toInt(_stage->localMinimum.y) + playerExtentY;
+  const s16 maximumY = F16_toInt(_stage->localMaximum.y) - playerExtentY;
+  s16 targetX = minimumX + (maximumX - minimumX) / 4;
+  s16 targetY = (minimumY + maximumY) / 2;
+  s16 nearest = AUTOPLAY_LOOKAHEAD;
+  Actor* actor = getFirstManagedActor();
+
+  // the only enemy worth dodging is the one that reaches the ship first, with
+  // nothing in the way it goes back to a spot with room all around
+  while (actor != NULL) {
+    const V2f16 enemyPosition = getActorPosition(actor);
+    const V2s16 enemyExtent = getActorExtent(actor);
+    const s16 enemyY = F16_toInt(enemyPosition.y);
+    const s16 deltaX = F16_toInt(enemyPosition.x) - playerX;
+    const s16 gap = max(abs(deltaX) - enemyExtent.x, 0);  // to the near edge
+    const s16 clearance = enemyExtent.y + playerExtentY + AUTOPLAY_MARGIN;
+
+    if ((deltaX >= 0 || gap < AUTOPLAY_LOOKBEHIND) && gap < nearest &&
+        abs(enemyY - playerY) < clearance) {
+      const s16 above = enemyY - clearance;
+      const s16 below = enemyY + clearance;
+
+      // stay on the side the ship is already on unless it runs out of room
+      if (playerY <= enemyY) {
+        targetY = above >= minimumY ? above : below;
+      } else {
+        targetY = below <= maximumY ? below : above;
+      }
+
+      nearest = gap;
+    }
+
+    actor = getNextManagedActor(actor);
+  }
+
+  u16 state = BUTTON_A;
+
+  if (targetX < playerX - AUTOPLAY_DEAD_ZONE) {
+    state |= BUTTON_LEFT;
+  } else if (targetX > playerX + AUTOPLAY_DEAD_ZONE) {
+    state |= BUTTON_RIGHT;
+  }
+
+  if (targetY < playerY - AUTOPLAY_DEAD_ZONE) {
+    state |= BUTTON_UP;
+  } else if (targetY > playerY + AUTOPLAY_DEAD_ZONE) {
+    state |= BUTTON_DOWN;
+  }
+
+  return state;
+}
+
+void setAutoplayEventHandler(JoyEventCallback* _handler) {
+  g_autoplayEventHandler = _handler;
+  g_autoplayStateFrames = 0;
+}
+#endif
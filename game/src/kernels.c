@@ -0,0 +1,218 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <genesis.h>
+
+#include "actor.h"
+#include "assert.h"
+#include "camera.h"
+#include "kernels.h"
+#include "log.h"
+
+// constants
+
+#define KERNELS_TEST_ACTORS 16
+#define KERNELS_BENCHMARK_RUNS 64
+
+// kernels_asm.s hard codes these offsets, a struct change fails to compile here
+// rather than quietly breaking the assembly versions
+#ifdef __m68k__
+#define KERNELS_OFFSET(_type, _field, _offset)                                 \
+  typedef char _type##_##_field##_OFFSET                                       \
+    [__builtin_offsetof(_type, _field) == (_offset) ? 1 : -1]
+
+KERNELS_OFFSET(Actor, position, 0);
+KERNELS_OFFSET(Actor, extent, 4);
+KERNELS_OFFSET(Actor, screenPosition, 8);
+KERNELS_OFFSET(Actor, onScreen, 12);
+KERNELS_OFFSET(Actor, wasOnScreen, 13);
+KERNELS_OFFSET(CameraView, localMinimum, 16);
+KERNELS_OFFSET(CameraView, localMaximum, 20);
+#endif
+
+#ifdef KERNELS_TEST_ENABLED
+static const CameraView k_kernelsTestViews[] = {
+  {{0, 0}, {320, 224}, {0, 0}, {320, 224}},
+  {{0, 0}, {320, 240}, {96, -24}, {416, 216}},
+  {{0, 0}, {320, 224}, {-200, 40}, {120, 264}}
+};
+static const s32 k_kernelsTestDeltas[] = {
+  0, 1, -1, FIX16(1), -FIX16(1), FIX16(511), -FIX16(511), 0x7FFFFF, -0x7FFFFF,
+  0x12345, -0x2468, 0x3FFF, -0x4000
+};
+#endif
+
+// entity
+
+#ifdef KERNELS_TEST_ENABLED
+struct _KernelsTestNode;
+typedef struct _KernelsTestNode KernelsTestNode;
+
+struct _KernelsTestNode {
+  Actor actor;
+  KernelsTestNode* next;
+};
+
+typedef void (*KernelsProjectFunction)(Actor* _first, u16 _nextOffset,
+                                       const CameraView* _view);
+#endif
+
+// global properties
+
+#ifdef KERNELS_TEST_ENABLED
+static KernelsTestNode g_kernelsReference[KERNELS_TEST_ACTORS];
+static KernelsTestNode g_kernelsCandidate[KERNELS_TEST_ACTORS];
+static u16 g_kernelsSeed;
+#endif
+
+// private functions
+
+#ifdef KERNELS_TEST_ENABLED
+// fixed sequence so every boot checks and times the same inputs
+static u16 getTestRandom() {
+  g_kernelsSeed = g_kernelsSeed * 25173 + 13849;
+
+  return g_kernelsSeed;
+}
+
+static void setUpTestActors(KernelsTestNode* _nodes) {
+  for (u16 i = 0; i < KERNELS_TEST_ACTORS; i++) {
+    Actor* actor = &_nodes[i].actor;
+
+    // positions straddle every edge of the test views
+    actor->position.x = (s16)(getTestRandom() % 0x8000) - FIX16(128);
+    actor->position.y = (s16)(getTestRandom() % 0x6000) - FIX16(128);
+    actor->extent.x = getTestRandom() % 33;
+    actor->extent.y = getTestRandom() % 33;
+    actor->screenPosition.x = 0x5555;
+    actor->screenPosition.y = 0x5555;
+    actor->onScreen = getTestRandom() & 1;
+    actor->wasOnScreen = FALSE;
+    _nodes[i].next = i + 1 < KERNELS_TEST_ACTORS ? &_nodes[i + 1] : NULL;
+  }
+}
+
+static void checkProjection() {
+  const u16 nextOffset = __builtin_offsetof(KernelsTestNode, next);
+
+  for (u16 i = 0; i < sizeof(k_kernelsTestViews) / sizeof(CameraView); i++) {
+    const CameraView* view = &k_kernelsTestViews[i];
+
+    g_kernelsSeed = i;
+    setUpTestActors(g_kernelsReference);
+    g_kernelsSeed = i;
+    setUpTestActors(g_kernelsCandidate);
+    projectActorListC(&g_kernelsReference[0].actor, nextOffset, view);
+    projectActorListAsm(&g_kernelsCandidate[0].actor, nextOffset, view);
+
+    for (u16 j = 0; j < KERNELS_TEST_ACTORS; j++) {
+      const Actor* reference = &g_kernelsReference[j].actor;
+      const Actor* candidate = &g_kernelsCandidate[j].actor;
+
+      assert(reference->onScreen == candidate->onScreen &&
+               reference->wasOnScreen == candidate->wasOnScreen &&
+               reference->screenPosition.x == candidate->screenPosition.x &&
+               reference->screenPosition.y == candidate->screenPosition.y,
+             "projectActorListAsm does not match the C version");
+    }
+  }
+}
+
+static void checkDistance() {
+  const u16 count = sizeof(k_kernelsTestDeltas) / sizeof(s32);
+
+  for (u16 i = 0; i < count; i++) {
+    for (u16 j = 0; j < count; j++) {
+      const s32 deltaX = k_kernelsTestDeltas[i];
+      const s32 deltaY = k_kernelsTestDeltas[j];
+
+      assert(getFastDistanceC(deltaX, deltaY) ==
+               getFastDistanceAsm(deltaX, deltaY),
+             "getFastDistanceAsm does not match the C version");
+    }
+  }
+}
+
+static u32 benchmarkProjection(KernelsProjectFunction _project) {
+  const u16 nextOffset = __builtin_offsetof(KernelsTestNode, next);
+  const u32 start = getSubTick();
+
+  for (u16 i = 0; i < KERNELS_BENCHMARK_RUNS; i++) {
+    _project(&g_kernelsReference[0].actor, nextOffset, &k_kernelsTestViews[1]);
+  }
+
+  return getSubTick() - start;
+}
+
+static u32 benchmarkDistance(u32 (*_distance)(s32 _deltaX, s32 _deltaY)) {
+  const u32 start = getSubTick();
+
+  for (u16 i = 0; i < KERNELS_BENCHMARK_RUNS; i++) {
+    for (s16 j = -8; j < 8; j++) {
+      _distance(j * 0x1234, i * 0x0345);
+    }
+  }
+
+  return getSubTick() - start;
+}
+
+// a subtick is 1/76800 s, close to a hundred 68000 cycles
+static void logBenchmark(const char* _name, u32 _c, u32 _assembly) {
+  const u32 saved = _c > _assembly ? (_c - _assembly) * 100 / _c : 0;
+
+  log("kernels: %s c %u, asm %u subticks, %u%% saved", _name, _c, _assembly,
+      saved);
+}
+#endif
+
+// public functions
+
+void initKernels() {
+#ifdef KERNELS_TEST_ENABLED
+#ifdef ASM_KERNELS
+  log("kernels: asm");
+#else
+  log("kernels: c");
+#endif
+
+  checkProjection();
+  checkDistance();
+
+  g_kernelsSeed = 0;
+  setUpTestActors(g_kernelsReference);
+  logBenchmark("projectActorList", benchmarkProjection(&projectActorListC),
+               benchmarkProjection(&projectActorListAsm));
+  logBenchmark("getFastDistance", benchmarkDistance(&getFastDistanceC),
+               benchmarkDistance(&getFastDistanceAsm));
+#endif
+}
+
+void projectActorListC(Actor* _first, u16 _nextOffset,
+                       const CameraView* _view) {
+  Actor* actor = _first;
+
+  while (actor != NULL) {
+    projectActor(actor, _view);
+
+    actor = *(Actor**)((u8*)actor + _nextOffset);
+  }
+}
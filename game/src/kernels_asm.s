@@ -0,0 +1,130 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Devon Powell
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Hand written versions of the kernels in kernels.h. Each one must give the
+ * exact results of its C version in kernels.c, which DEBUG builds made with
+ * --kernels-test check and time at boot. Struct offsets are hard coded and
+ * checked against the C structs in kernels.c. Comments are C style as the
+ * assembler is run with --bitwise-or, which turns | into an operator.
+ */
+
+        .text
+
+/* void projectActorListAsm(Actor* _first, u16 _nextOffset,
+ *                          const CameraView* _view)
+ *
+ * d0/d1 left and top, d2-d5 the view's local minimum and maximum, d6 right or
+ * bottom edge, d7 scratch, a0 the actor, a2 the next pointer offset
+ */
+
+        .globl  projectActorListAsm
+projectActorListAsm:
+        movem.l d2-d7/a2,-(sp)
+        movea.l 32(sp),a0               /* _first */
+        movea.l 36(sp),a2               /* _nextOffset, promoted to a long */
+        movea.l 40(sp),a1               /* _view */
+        movem.w 16(a1),d2-d5            /* localMinimum, localMaximum */
+        bra.s   4f
+
+1:      move.b  12(a0),13(a0)           /* wasOnScreen = onScreen */
+        moveq   #31,d7                  /* F16_toRoundedInt, FIX16(0.5) - 1 */
+        move.w  (a0),d0                 /* position.x */
+        ext.l   d0
+        add.l   d7,d0
+        asr.l   #6,d0
+        move.w  2(a0),d1                /* position.y */
+        ext.l   d1
+        add.l   d7,d1
+        asr.l   #6,d1
+
+        move.w  4(a0),d7                /* extent.x */
+        move.w  d0,d6
+        add.w   d7,d6
+        cmp.w   d2,d6
+        ble.s   2f                      /* right edge left of the view */
+        sub.w   d7,d0
+        cmp.w   d4,d0
+        bge.s   2f                      /* left edge right of the view */
+        move.w  6(a0),d7                /* extent.y */
+        move.w  d1,d6
+        add.w   d7,d6
+        cmp.w   d3,d6
+        ble.s   2f                      /* bottom edge above the view */
+        sub.w   d7,d1
+        cmp.w   d5,d1
+        bge.s   2f                      /* top edge below the view */
+
+        sub.w   d2,d0
+        sub.w   d3,d1
+        move.w  d0,8(a0)                /* screenPosition */
+        move.w  d1,10(a0)
+        move.b  #1,12(a0)               /* onScreen = TRUE */
+        bra.s   3f
+
+2:      clr.b   12(a0)                  /* onScreen = FALSE */
+
+3:      movea.l 0(a0,a2.l),a0           /* next actor */
+4:      move.l  a0,d7
+        bne.s   1b
+
+        movem.l (sp)+,d2-d7/a2
+        rts
+
+/* u32 getFastDistanceAsm(s32 _deltaX, s32 _deltaY)
+ *
+ * (longer * 246 + shorter * 102) >> 8 out of shifts and adds, wrapping the
+ * same way SGDK's getApproximatedDistance does
+ */
+
+        .globl  getFastDistanceAsm
+getFastDistanceAsm:
+        move.l  4(sp),d0                /* _deltaX */
+        bpl.s   1f
+        neg.l   d0
+1:      move.l  8(sp),d1                /* _deltaY */
+        bpl.s   2f
+        neg.l   d1
+2:      cmp.l   d1,d0
+        bcc.s   3f
+        exg     d0,d1                   /* d0 longer, d1 shorter */
+
+3:      movea.l d1,a1                   /* shorter * 102 = */
+                                        /*   shorter * 17 * 3 * 2 */
+        lsl.l   #4,d1
+        add.l   a1,d1
+        movea.l d1,a1
+        add.l   d1,d1
+        add.l   a1,d1
+        add.l   d1,d1
+        movea.l d1,a1
+
+        move.l  d0,d1                   /* longer * 246 = (longer * 128 - */
+        lsl.l   #7,d0                   /*   longer * 5) * 2 */
+        sub.l   d1,d0
+        lsl.l   #2,d1
+        sub.l   d1,d0
+        add.l   d0,d0
+
+        add.l   a1,d0
+        lsr.l   #8,d0
+        rts
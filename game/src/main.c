@@ -22,14 +22,25 @@
 
 #include <genesis.h>
 
+#include "actors/enemies/boss.h"
 #include "actors/enemies/homing_mine.h"
 #include "actors/enemies/mine.h"
 #include "actors/player.h"
+#include "ai_scheduler.h"
+#include "arena.h"
+#include "audio.h"
 #include "camera.h"
 #include "game.h"
+#include "governor.h"
+#include "hot_data.h"
+#include "hud.h"
+#include "input.h"
+#include "kernels.h"
 #include "log.h"
 #include "managed_actor.h"
+#include "particles.h"
 #include "stage.h"
+#include "trace.h"
 #include "utilities.h"
 
 // private functions
@@ -37,13 +48,25 @@
 static void init(bool _hardReset) {
   log("initializing subsystems...");
 
+  initHotData(_hardReset);
   initUtilities();
+  initInput();
+  initKernels();
+  initTrace();
+  initArena();
   initStage();
   initCamera();
+  initActors();
   initPlayer();
   initMine();
   initHomingMine();
+  initBoss();
   initManagedActors();
+  initParticles();
+  initAIScheduler();
+  initGovernor();
+  initHud();
+  initAudio();
 
   log("initializing subsystems...done");
 
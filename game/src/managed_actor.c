@@ -23,7 +23,10 @@
 #include <genesis.h>
 
 #include "actor.h"
+#include "arena.h"
 #include "assert.h"
+#include "hot_data.h"
+#include "kernels.h"
 #include "managed_actor.h"
 
 // entity
@@ -38,47 +41,51 @@ struct _ManagedActor {
   bool cleanUp;
 };
 
-// global properties
-
-static ManagedActor* g_firstManagedActor = NULL;
-static ManagedActor* g_lastManagedActor = NULL;
-
 // public functions
 
 void initManagedActors() {
-  if (g_firstManagedActor != NULL) {
+  if (HOT_DATA.firstManagedActor != NULL) {
     destroyManagedActors();
   }
 
-  g_firstManagedActor = NULL;
-  g_lastManagedActor = NULL;
+  HOT_DATA.firstManagedActor = NULL;
+  HOT_DATA.lastManagedActor = NULL;
 }
 
-void createManagedActor(V2f32 _position, void* _data,
-                        ActorUpdateCallback _updateCallback,
-                        ActorDrawCallback _drawCallback,
-                        ActorDestroyCallback _destroyCallback) {
-  ManagedActor* managedActor = malloc(sizeof(ManagedActor));
+Actor* createManagedActor(V2f16 _position, void* _data,
+                          ActorUpdateCallback _updateCallback,
+                          ActorDrawCallback _drawCallback,
+                          ActorDestroyCallback _destroyCallback) {
+  ManagedActor* managedActor =
+    allocateArena(sizeof(ManagedActor), ARENA_TAG_ACTORS);
 
-  assert(managedActor != NULL, "Failed to allocate managed actor");
+  if (managedActor == NULL) {
+    return NULL;
+  }
 
   Actor* actor = &managedActor->actor;
 
-  setUpActor(actor, _position, _data, _updateCallback, _drawCallback,
-             _destroyCallback);
+  if (!setUpActor(actor, _position, _data, _updateCallback, _drawCallback,
+                  _destroyCallback)) {
+    freeArena(managedActor, sizeof(ManagedActor), ARENA_TAG_ACTORS);
+
+    return NULL;
+  }
 
   managedActor->next = NULL;
   managedActor->cleanUp = FALSE;
 
-  if (g_firstManagedActor == NULL) {
+  if (HOT_DATA.firstManagedActor == NULL) {
     managedActor->previous = NULL;
-    g_firstManagedActor = managedActor;
-    g_lastManagedActor = managedActor;
-  } else if (g_lastManagedActor != NULL) {
-    managedActor->previous = g_lastManagedActor;
-    g_lastManagedActor->next = managedActor;
-    g_lastManagedActor = managedActor;
+    HOT_DATA.firstManagedActor = managedActor;
+    HOT_DATA.lastManagedActor = managedActor;
+  } else if (HOT_DATA.lastManagedActor != NULL) {
+    managedActor->previous = HOT_DATA.lastManagedActor;
+    HOT_DATA.lastManagedActor->next = managedActor;
+    HOT_DATA.lastManagedActor = managedActor;
   }
+
+  return actor;
 }
 
 void updateManagedActors(const Stage* _stage) {
@@ -86,15 +93,19 @@ void updateManagedActors(const Stage* _stage) {
     return;
   }
 
-  ManagedActor* managedActor = g_firstManagedActor;
+  ManagedActor* managedActor = HOT_DATA.firstManagedActor;
 
   while (managedActor != NULL) {
-    if (managedActor->cleanUp) {
-      Actor* actor = &managedActor->actor;
+    Actor* actor = &managedActor->actor;
 
-      if (actor->destroyCallback != NULL) {
-        actor->destroyCallback(actor);
-      }
+    // actors left behind by the scroll will never be seen again and would
+    // eventually fall out of the range of their chunk relative position
+    if (isActorBehindStage(actor, _stage)) {
+      managedActor->cleanUp = TRUE;
+    }
+
+    if (managedActor->cleanUp) {
+      tearDownActor(actor);
 
       ManagedActor* managedActorNext = managedActor->next;
       ManagedActor* managedActorPrevious = managedActor->previous;
@@ -102,23 +113,23 @@ void updateManagedActors(const Stage* _stage) {
       if (managedActorPrevious) {
         managedActorPrevious->next = managedActorNext;
       } else {
-        g_firstManagedActor = managedActorNext;
+        HOT_DATA.firstManagedActor = managedActorNext;
       }
 
       if (managedActorNext) {
         managedActorNext->previous = managedActor->previous;
       } else {
-        g_lastManagedActor = managedActorPrevious;
+        HOT_DATA.lastManagedActor = managedActorPrevious;
       }
 
-      free(managedActor);
+      freeArena(managedActor, sizeof(ManagedActor), ARENA_TAG_ACTORS);
 
       managedActor = managedActorNext;
 
       continue;
     }
 
-    updateActor(&managedActor->actor, _stage);
+    updateActor(actor, _stage);
 
     managedActor = managedActor->next;
   }
@@ -129,34 +140,35 @@ void drawManagedActors(const Camera* _camera) {
     return;
   }
 
-  ManagedActor* managedActor = g_firstManagedActor;
+  const CameraView* view = getCameraView(_camera);
+  ManagedActor* managedActor = HOT_DATA.firstManagedActor;
+
+  // project and cull everything up front so the sprite engine is only touched
+  // by actors that actually need drawing
+  projectActorList((Actor*)managedActor,
+                   __builtin_offsetof(ManagedActor, next), view);
 
   while (managedActor != NULL) {
-    drawActor(&managedActor->actor, _camera);
+    drawActor(&managedActor->actor);
 
     managedActor = managedActor->next;
   }
 }
 
 void destroyManagedActors() {
-  ManagedActor* managedActor = g_firstManagedActor;
+  ManagedActor* managedActor = HOT_DATA.firstManagedActor;
 
   while (managedActor != NULL) {
-    Actor* actor = &managedActor->actor;
-
-    if (actor->destroyCallback != NULL) {
-      actor->destroyCallback(actor);
-    }
-
     ManagedActor* managedActorNext = managedActor->next;
 
-    free(managedActor);
+    tearDownActor(&managedActor->actor);
+    freeArena(managedActor, sizeof(ManagedActor), ARENA_TAG_ACTORS);
 
     managedActor = managedActorNext;
   }
 
-  g_firstManagedActor = NULL;
-  g_lastManagedActor = NULL;
+  HOT_DATA.firstManagedActor = NULL;
+  HOT_DATA.lastManagedActor = NULL;
 }
 
 void setManagedActorCleanUp(Actor* _actor) {
@@ -164,3 +176,13 @@ void setManagedActorCleanUp(Actor* _actor) {
 
   managedActor->cleanUp = TRUE;
 }
+
+Actor* getFirstManagedActor() {
+  return (Actor*)HOT_DATA.firstManagedActor;
+}
+
+Actor* getNextManagedActor(const Actor* _actor) {
+  const ManagedActor* managedActor = (const ManagedActor*)_actor;
+
+  return (Actor*)managedActor->next;
+}
@@ -0,0 +1,418 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <genesis.h>
+
+#include "assert.h"
+#include "camera.h"
+#include "governor.h"
+#include "hot_data.h"
+#include "particles.h"
+#include "sprites.h"
+#include "stage.h"
+#include "trace.h"
+#include "utilities.h"
+
+// constants
+
+#define PARTICLES_MAX 24              // must fit in the alive mask
+#define PARTICLES_SPAWN_BUDGET 12     // particles/frame
+#define PARTICLES_EXPLOSION_SPEED 90  // pixels/second
+#define PARTICLES_EXPLOSION_DIRECTIONS 8
+#define PARTICLES_SIZE 8          // pixels, one tile
+#define PARTICLES_PLANE_WIDTH 64  // tiles
+#define PARTICLES_CELL_NONE 0xFFFF
+#define PARTICLES_FRAME_NONE 0xFF
+#define PARTICLES_SPRITE_FLAGS                                                 \
+  (SPR_FLAG_AUTO_VRAM_ALLOC | SPR_FLAG_AUTO_TILE_UPLOAD)
+
+typedef struct {
+  const u8* frames;  // sprite frame for every frame of the particle's life
+  u8 length;         // frames
+} ParticleAnimation;
+
+// animation frames baked per frame so the age is the table index
+static const u8 k_sparkNtscFrames[] = {0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3, 3};
+static const u8 k_sparkPalFrames[] = {0, 0, 0, 1, 1, 2, 2, 2, 3, 3};
+static const u8 k_emberNtscFrames[] = {
+  1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3
+};
+static const u8 k_emberPalFrames[] = {
+  1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3
+};
+static const ParticleAnimation k_sparkAnimations[] = {
+  {k_sparkNtscFrames, sizeof(k_sparkNtscFrames)},  // ntsc
+  {k_sparkPalFrames, sizeof(k_sparkPalFrames)}     // pal
+};
+static const ParticleAnimation k_emberAnimations[] = {
+  {k_emberNtscFrames, sizeof(k_emberNtscFrames)},  // ntsc
+  {k_emberPalFrames, sizeof(k_emberPalFrames)}     // pal
+};
+static const ParticleAnimation* const k_particleAnimations[] = {
+  k_sparkAnimations,  // spark
+  k_emberAnimations   // ember
+};
+
+static const f16 k_particleExplosionSpeeds[] = {
+  FIX16(NTSC_PER_FRAME(PARTICLES_EXPLOSION_SPEED)),  // ntsc
+  FIX16(PAL_PER_FRAME(PARTICLES_EXPLOSION_SPEED))    // pal
+};
+
+// unit vectors, every other one is dropped when the budget is reduced
+static const V2f16 k_particleExplosionDirections[] = {
+  {FIX16(1), 0},                     // east
+  {FIX16(0.7071), FIX16(0.7071)},    // south east
+  {0, FIX16(1)},                     // south
+  {FIX16(-0.7071), FIX16(0.7071)},   // south west
+  {FIX16(-1), 0},                    // west
+  {FIX16(-0.7071), FIX16(-0.7071)},  // north west
+  {0, FIX16(-1)},                    // north
+  {FIX16(0.7071), FIX16(-0.7071)}    // north east
+};
+
+// global properties
+
+static const ParticleAnimation* g_particleAnimations[PARTICLE_EFFECT_COUNT];
+static V2f16 g_particleExplosionVelocities[PARTICLES_EXPLOSION_DIRECTIONS];
+static u8 g_particleSpawnBudget;  // particles left this frame, not tick
+static bool g_particleTilesAllowed;
+static u16 g_particleTilesFirstRow;  // tiles, BG_A is hidden above it
+static u16 g_particleTileIndex;
+static u16 g_particlePalette;
+
+// the pool is kept as parallel arrays so each pass only touches the fields it
+// needs and a slot is just an index
+static f16 g_particleX[PARTICLES_MAX];          // pixels, stage chunk relative
+static f16 g_particleY[PARTICLES_MAX];          // pixels, stage chunk relative
+static f16 g_particleVelocityX[PARTICLES_MAX];  // pixels/frame
+static f16 g_particleVelocityY[PARTICLES_MAX];  // pixels/frame
+static u8 g_particleAge[PARTICLES_MAX];         // frames
+static u8 g_particleEffect[PARTICLES_MAX];
+static u8 g_particlePriority[PARTICLES_MAX];
+static Sprite* g_particleSprites[PARTICLES_MAX];
+static u8 g_particleSlots;                  // got a sprite, the rest go unused
+static u32 g_particleSpritesVisible;        // last submitted, one bit per slot
+static u8 g_particleFrames[PARTICLES_MAX];  // last submitted
+static u16 g_particleCells[PARTICLES_MAX];  // last written on BG_A
+
+// private functions
+
+static s8 findFreeSlot() {
+  const u32 free = ~HOT_DATA.particleAlive;
+
+  for (u8 i = 0; i < g_particleSlots; i++) {
+    if (free & ((u32)1 << i)) {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+static s8 findStolenSlot(ParticlePriority _priority) {
+  s8 slot = -1;
+  u8 slotPriority = _priority;
+  u8 slotRemaining = 0xFF;
+
+  // the lowest priority goes first, the one closest to dying breaks ties
+  for (u8 i = 0; i < g_particleSlots; i++) {
+    const u8 priority = g_particlePriority[i];
+    const u8 remaining =
+      g_particleAnimations[g_particleEffect[i]]->length - g_particleAge[i];
+
+    if (priority < slotPriority ||
+        (priority == slotPriority && remaining < slotRemaining)) {
+      slot = i;
+      slotPriority = priority;
+      slotRemaining = remaining;
+    }
+  }
+
+  return slot;
+}
+
+static void clearCell(u8 _slot) {
+  const u16 cell = g_particleCells[_slot];
+
+  if (cell == PARTICLES_CELL_NONE) {
+    return;
+  }
+
+  VDP_setTileMapXY(BG_A, 0, cell % PARTICLES_PLANE_WIDTH,
+                   cell / PARTICLES_PLANE_WIDTH);
+
+  g_particleCells[_slot] = PARTICLES_CELL_NONE;
+  g_particleFrames[_slot] = PARTICLES_FRAME_NONE;
+}
+
+static void hideSprite(u8 _slot) {
+  const u32 bit = (u32)1 << _slot;
+
+  if (!(g_particleSpritesVisible & bit)) {
+    return;
+  }
+
+  SPR_setVisibility(g_particleSprites[_slot], HIDDEN);
+
+  g_particleSpritesVisible &= ~bit;
+  g_particleFrames[_slot] = PARTICLES_FRAME_NONE;
+}
+
+static void drawTile(u8 _slot, s16 _x, s16 _y, u8 _frame) {
+  // only used while BG_A isn't scrolled so screen and plane cells line up,
+  // tiles snap to the 8x8 grid but on a heavy frame nobody will notice
+  const u16 cell = ((_y + PARTICLES_SIZE / 2) >> 3) * PARTICLES_PLANE_WIDTH +
+                   ((_x + PARTICLES_SIZE / 2) >> 3);
+
+  if (cell == g_particleCells[_slot] && _frame == g_particleFrames[_slot]) {
+    return;
+  }
+
+  clearCell(_slot);
+  VDP_setTileMapXY(BG_A,
+                   TILE_ATTR_FULL(g_particlePalette, FALSE, FALSE, FALSE,
+                                  g_particleTileIndex + _frame),
+                   cell % PARTICLES_PLANE_WIDTH, cell / PARTICLES_PLANE_WIDTH);
+
+  g_particleCells[_slot] = cell;
+  g_particleFrames[_slot] = _frame;
+}
+
+static void drawSprite(u8 _slot, s16 _x, s16 _y, u8 _frame) {
+  const u32 bit = (u32)1 << _slot;
+  Sprite* sprite = g_particleSprites[_slot];
+
+  if (!(g_particleSpritesVisible & bit)) {
+    SPR_setVisibility(sprite, VISIBLE);
+
+    g_particleSpritesVisible |= bit;
+  }
+
+  if (_frame != g_particleFrames[_slot]) {
+    SPR_setFrame(sprite, _frame);
+
+    g_particleFrames[_slot] = _frame;
+  }
+
+  SPR_setPosition(sprite, _x, _y);
+}
+
+// public functions
+
+void initParticles() {
+  const u8 rate = getFrameRateIndex();
+  const f16 speed = k_particleExplosionSpeeds[rate];
+
+  for (u8 i = 0; i < PARTICLE_EFFECT_COUNT; i++) {
+    g_particleAnimations[i] = &k_particleAnimations[i][rate];
+  }
+
+  for (u8 i = 0; i < PARTICLES_EXPLOSION_DIRECTIONS; i++) {
+    const V2f16 direction = k_particleExplosionDirections[i];
+
+    g_particleExplosionVelocities[i].x = F16_mul(direction.x, speed);
+    g_particleExplosionVelocities[i].y = F16_mul(direction.y, speed);
+  }
+
+  HOT_DATA.particleAlive = 0;
+  g_particleSpritesVisible = 0;
+  g_particleTilesAllowed = TRUE;
+  g_particleTilesFirstRow = 0;
+}
+
+u16 setUpParticles(u16 _palette, u16 _tileIndex) {
+  const u16 attributes = TILE_ATTR(_palette, FALSE, FALSE, FALSE);
+
+  // the sprite frames are also loaded as plain tiles for the plane fallback
+  VDP_loadTileSet(&k_sparkTileSet, _tileIndex, DMA);
+
+  g_particleSlots = 0;
+
+  // short of sprites the pool just gets smaller, effects are never worth
+  // failing the stage over
+  for (u8 i = 0; i < PARTICLES_MAX; i++) {
+    Sprite* sprite = SPR_addSpriteExSafe(&k_sparkSprite, 0, 0, attributes,
+                                         PARTICLES_SPRITE_FLAGS);
+
+    if (sprite == NULL) {
+      break;
+    }
+
+    g_particleSprites[i] = sprite;
+    g_particleFrames[i] = PARTICLES_FRAME_NONE;
+    g_particleCells[i] = PARTICLES_CELL_NONE;
+    g_particleSlots++;
+
+    SPR_setVisibility(sprite, HIDDEN);
+  }
+
+  HOT_DATA.particleAlive = 0;
+  g_particleSpritesVisible = 0;
+  g_particleSpawnBudget = PARTICLES_SPAWN_BUDGET;
+  g_particleTilesAllowed = TRUE;
+  g_particleTilesFirstRow = 0;
+  g_particleTileIndex = _tileIndex;
+  g_particlePalette = _palette;
+
+  return _tileIndex + k_sparkTileSet.numTile;
+}
+
+void updateParticles(const Stage* _stage) {
+  const f16 shift = FIX16(_stage->originShift);
+  u32 alive = HOT_DATA.particleAlive;
+
+  for (u8 i = 0; alive != 0; i++, alive >>= 1) {
+    if (!(alive & 1)) {
+      continue;
+    }
+
+    const u8 age = g_particleAge[i] + 1;
+
+    if (age >= g_particleAnimations[g_particleEffect[i]]->length) {
+      HOT_DATA.particleAlive &= ~((u32)1 << i);
+
+      continue;
+    }
+
+    // keep the position relative to the stage chunk origin like actors do,
+    // this runs before them so anything they spawn is already relative to
+    // the new origin and doesn't age until the next tick
+    g_particleX[i] += g_particleVelocityX[i] - shift;
+    g_particleY[i] += g_particleVelocityY[i];
+    g_particleAge[i] = age;
+  }
+}
+
+void resetParticleSpawnBudget() {
+  g_particleSpawnBudget = isGovernorLevelAtLeast(GOVERNOR_LEVEL_REDUCED)
+                            ? PARTICLES_SPAWN_BUDGET / 2
+                            : PARTICLES_SPAWN_BUDGET;
+}
+
+void drawParticles(const Camera* _camera) {
+  const CameraView* view = getCameraView(_camera);
+  const V2s16 minimum = view->localMinimum;
+  const V2s16 maximum = view->localMaximum;
+  const bool tiles = g_particleTilesAllowed &&
+                     isGovernorLevelAtLeast(GOVERNOR_LEVEL_REDUCED);
+  const u32 alive = HOT_DATA.particleAlive;
+
+  // a heavy frame moves effects onto BG_A so they cost no sprites at all
+  for (u8 i = 0; i < g_particleSlots; i++) {
+    const s16 x = F16_toInt(g_particleX[i]) - minimum.x - PARTICLES_SIZE / 2;
+    const s16 y = F16_toInt(g_particleY[i]) - minimum.y - PARTICLES_SIZE / 2;
+    const bool visible = ((alive >> i) & 1) && x >= 0 && y >= 0 &&
+                         x < maximum.x - minimum.x - PARTICLES_SIZE &&
+                         y < maximum.y - minimum.y - PARTICLES_SIZE;
+
+    if (!visible) {
+      hideSprite(i);
+      clearCell(i);
+
+      continue;
+    }
+
+    const u8 frame =
+      g_particleAnimations[g_particleEffect[i]]->frames[g_particleAge[i]];
+
+    // the window draws over BG_A, a tile under it would just vanish
+    if (tiles && ((y + PARTICLES_SIZE / 2) >> 3) >= g_particleTilesFirstRow) {
+      hideSprite(i);
+      drawTile(i, x, y, frame);
+    } else {
+      clearCell(i);
+      drawSprite(i, x, y, frame);
+    }
+  }
+}
+
+void tearDownParticles() {
+  for (u8 i = 0; i < g_particleSlots; i++) {
+    clearCell(i);
+    SPR_releaseSprite(g_particleSprites[i]);
+
+    g_particleSprites[i] = NULL;
+  }
+
+  HOT_DATA.particleAlive = 0;
+  g_particleSpritesVisible = 0;
+  g_particleSlots = 0;
+}
+
+bool spawnParticle(ParticleEffect _effect, V2f16 _position, V2f16 _velocity,
+                   ParticlePriority _priority) {
+  assert(_effect < PARTICLE_EFFECT_COUNT, "Unknown particle effect");
+
+  if (g_particleSpawnBudget == 0) {
+    trace(TRACE_EVENT_PARTICLE_DROPPED, _effect, _priority);
+
+    return FALSE;
+  }
+
+  s8 slot = findFreeSlot();
+
+  // a full pool never allocates, something less important makes room instead
+  if (slot < 0) {
+    slot = findStolenSlot(_priority);
+
+    if (slot < 0) {
+      trace(TRACE_EVENT_PARTICLE_DROPPED, _effect, _priority);
+
+      return FALSE;
+    }
+
+    trace(TRACE_EVENT_PARTICLE_STOLEN, slot, _priority);
+  }
+
+  HOT_DATA.particleAlive |= (u32)1 << slot;
+  g_particleX[slot] = _position.x;
+  g_particleY[slot] = _position.y;
+  g_particleVelocityX[slot] = _velocity.x;
+  g_particleVelocityY[slot] = _velocity.y;
+  g_particleAge[slot] = 0;
+  g_particleEffect[slot] = _effect;
+  g_particlePriority[slot] = _priority;
+
+  g_particleSpawnBudget--;
+
+  return TRUE;
+}
+
+void spawnExplosion(V2f16 _position, ParticlePriority _priority) {
+  const V2f16 still = {0, 0};
+  const u8 step = isGovernorLevelAtLeast(GOVERNOR_LEVEL_REDUCED) ? 2 : 1;
+
+  spawnParticle(PARTICLE_EFFECT_EMBER, _position, still, _priority);
+
+  for (u8 i = 0; i < PARTICLES_EXPLOSION_DIRECTIONS; i += step) {
+    spawnParticle(PARTICLE_EFFECT_SPARK, _position,
+                  g_particleExplosionVelocities[i], _priority);
+  }
+}
+
+void setParticleTilesAllowed(bool _allowed) {
+  g_particleTilesAllowed = _allowed;
+}
+
+void setParticleTilesFirstRow(u16 _row) {
+  g_particleTilesFirstRow = _row;
+}
@@ -0,0 +1,62 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <genesis.h>
+
+#include "path.h"
+#include "utilities.h"
+
+// public functions
+
+void setUpPathFollower(PathFollower* _follower, const Path _paths[]) {
+  // baked paths come as one table per frame rate
+  _follower->path = _paths != NULL ? &_paths[getFrameRateIndex()] : NULL;
+  _follower->index = 0;
+}
+
+bool advancePath(PathFollower* _follower, V2f16* _position) {
+  const Path* path = _follower->path;
+
+  if (path == NULL) {
+    return FALSE;
+  }
+
+  u16 index = _follower->index;
+
+  if (index >= path->length) {
+    if (!path->loop) {
+      _follower->path = NULL;
+
+      return FALSE;
+    }
+
+    index = 0;
+  }
+
+  const V2f16 delta = path->deltas[index];
+
+  _position->x = _position->x + delta.x;
+  _position->y = _position->y + delta.y;
+  _follower->index = index + 1;
+
+  return TRUE;
+}
@@ -0,0 +1,300 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <genesis.h>
+
+#include "actor.h"
+#include "log.h"
+#include "managed_actor.h"
+#include "scanlines.h"
+
+#ifdef DEBUG
+
+// constants
+
+#define SCANLINES_MAX 240            // pixels, tallest screen
+#define SCANLINES_ROWS 30            // tiles, tallest screen
+#define SCANLINES_FIRST_ROW 1        // tiles, the hud has the row above
+#define SCANLINES_COLUMNS 2          // tiles, one window position step
+#define SCANLINES_SPRITE_OFFSET 128  // pixels, vdp sprite coordinates origin
+#define SCANLINES_RECORDS 4
+#define SCANLINES_RECORD_ACTORS 4
+#define SCANLINES_PALETTE PAL3       // never loaded by the game
+#define SCANLINES_COLOR (RGB24_TO_VDPCOLOR(0xFF2020))
+
+// entity
+
+typedef struct {
+  u16 frame;                                      // low bits of vtimer
+  u16 line;                                       // pixels
+  u16 sprites;
+  u16 pixels;
+  u16 actorCount;
+  V2s16 actorPositions[SCANLINES_RECORD_ACTORS];  // screen, top left
+  V2s16 actorExtents[SCANLINES_RECORD_ACTORS];    // pixels, half size
+} ScanlineRecord;
+
+// global properties
+
+static bool g_scanlinesActive;
+static u16 g_scanlinesColumn;  // tiles, first sidebar column
+static u16 g_scanlinesOverflowFrames;
+static u16 g_scanlinesOverflowLines;  // last logged
+static s8 g_scanlineSpriteDeltas[SCANLINES_MAX + 1];
+static s16 g_scanlinePixelDeltas[SCANLINES_MAX + 1];
+static u16 g_scanlineTiles[SCANLINES_ROWS][SCANLINES_COLUMNS];  // sidebar
+static ScanlineRecord g_scanlineRecords[SCANLINES_RECORDS];     // unordered
+
+// private functions
+
+static bool isScanlineWorse(u16 _sprites, u16 _pixels,
+                            const ScanlineRecord* _record) {
+  return _sprites > _record->sprites ||
+         (_sprites == _record->sprites && _pixels > _record->pixels);
+}
+
+// sprites and widths are added where a sprite starts and taken off where it
+// ends, so a single pass over the lines gives every count
+static void countSprites(u16 _height) {
+  memset(g_scanlineSpriteDeltas, 0, sizeof(g_scanlineSpriteDeltas));
+  memset(g_scanlinePixelDeltas, 0, sizeof(g_scanlinePixelDeltas));
+
+  u16 index = 0;
+
+  // follows the links the same way the vdp does
+  for (u16 i = 0; i < MAX_VDP_SPRITE; i++) {
+    const VDPSprite* sprite = &vdpSpriteCache[index];
+    const s16 top = sprite->y - SCANLINES_SPRITE_OFFSET;
+    const s16 first = max(top, 0);
+    const s16 last = min(top + ((sprite->size & 3) + 1) * 8, (s16)_height);
+
+    if (first < last) {
+      const s16 width = (((sprite->size >> 2) & 3) + 1) * 8;
+
+      g_scanlineSpriteDeltas[first]++;
+      g_scanlineSpriteDeltas[last]--;
+      g_scanlinePixelDeltas[first] += width;
+      g_scanlinePixelDeltas[last] -= width;
+    }
+
+    index = sprite->link;
+
+    if (index == 0) {
+      break;
+    }
+  }
+}
+
+static void setSidebarTile(u16 _row, u16 _column, char _character) {
+  const u16 tile =
+    _character == ' ' ? 0
+                      : TILE_ATTR_FULL(SCANLINES_PALETTE, TRUE, FALSE, FALSE,
+                                       TILE_FONT_INDEX + _character - ' ');
+
+  if (g_scanlineTiles[_row][_column] == tile) {
+    return;
+  }
+
+  g_scanlineTiles[_row][_column] = tile;
+
+  VDP_setTileMapXY(WINDOW, tile, g_scanlinesColumn + _column, _row);
+}
+
+static void addRecordActor(ScanlineRecord* _record, const Actor* _actor) {
+  if (_actor == NULL || !isActorOnScreen(_actor) ||
+      _record->actorCount >= SCANLINES_RECORD_ACTORS) {
+    return;
+  }
+
+  const V2s16 position = getActorScreenPosition(_actor);
+  const V2s16 extent = getActorExtent(_actor);
+  const s16 line = _record->line;
+
+  if (line < position.y || line >= position.y + extent.y * 2) {
+    return;
+  }
+
+  _record->actorPositions[_record->actorCount] = position;
+  _record->actorExtents[_record->actorCount] = extent;
+  _record->actorCount++;
+}
+
+static void recordScanline(u16 _line, u16 _sprites, u16 _pixels,
+                           const Actor* _player) {
+  ScanlineRecord* record = &g_scanlineRecords[0];
+
+  for (u16 i = 1; i < SCANLINES_RECORDS; i++) {
+    if (isScanlineWorse(record->sprites, record->pixels,
+                        &g_scanlineRecords[i])) {
+      record = &g_scanlineRecords[i];
+    }
+  }
+
+  // the same crowd stays put for a while, only something worse is kept
+  if (!isScanlineWorse(_sprites, _pixels, record)) {
+    return;
+  }
+
+  record->frame = vtimer;
+  record->line = _line;
+  record->sprites = _sprites;
+  record->pixels = _pixels;
+  record->actorCount = 0;
+
+  addRecordActor(record, _player);
+
+  const Actor* actor = getFirstManagedActor();
+
+  while (actor != NULL) {
+    addRecordActor(record, actor);
+
+    actor = getNextManagedActor(actor);
+  }
+}
+
+static void logRecords() {
+  for (u16 i = 0; i < SCANLINES_RECORDS; i++) {
+    const ScanlineRecord* record = &g_scanlineRecords[i];
+
+    if (record->sprites == 0) {
+      continue;
+    }
+
+    log("scanlines: frame %u, line %u, %u sprites, %u pixels", record->frame,
+        record->line, record->sprites, record->pixels);
+
+    for (u16 j = 0; j < record->actorCount; j++) {
+      log("scanlines:   actor at %d, %d, %d x %d",
+          record->actorPositions[j].x, record->actorPositions[j].y,
+          record->actorExtents[j].x * 2, record->actorExtents[j].y * 2);
+    }
+  }
+}
+
+#endif
+
+// public functions
+
+void setUpScanlines() {
+#ifdef DEBUG
+  memset(g_scanlineTiles, 0, sizeof(g_scanlineTiles));
+  memset(g_scanlineRecords, 0, sizeof(g_scanlineRecords));
+
+  g_scanlinesColumn = VDP_getScreenWidth() / 8 - SCANLINES_COLUMNS;
+  g_scanlinesOverflowFrames = 0;
+  g_scanlinesOverflowLines = 0;
+  g_scanlinesActive = TRUE;
+
+  PAL_setColor(SCANLINES_PALETTE * 16 + 15, SCANLINES_COLOR);
+  VDP_clearTileMapRect(WINDOW, g_scanlinesColumn, SCANLINES_FIRST_ROW,
+                       SCANLINES_COLUMNS, SCANLINES_ROWS - SCANLINES_FIRST_ROW);
+  VDP_setWindowHPos(TRUE, g_scanlinesColumn / SCANLINES_COLUMNS);
+#endif
+}
+
+void tearDownScanlines() {
+#ifdef DEBUG
+  log("scanlines: %u frames over the vdp limits", g_scanlinesOverflowFrames);
+  logRecords();
+
+  g_scanlinesActive = FALSE;
+
+  VDP_setWindowHPos(FALSE, 0);
+  VDP_clearTileMapRect(WINDOW, g_scanlinesColumn, SCANLINES_FIRST_ROW,
+                       SCANLINES_COLUMNS, SCANLINES_ROWS - SCANLINES_FIRST_ROW);
+#endif
+}
+
+void showScanlines(const Actor* _player) {
+#ifdef DEBUG
+  if (!g_scanlinesActive) {
+    return;
+  }
+
+  const u16 height = VDP_getScreenHeight();
+  const bool wide = VDP_getScreenWidth() == 320;
+  const u16 spritesMax = wide ? 20 : 16;
+  const u16 pixelsMax = wide ? 320 : 256;
+  u16 sprites = 0;
+  u16 pixels = 0;
+  u16 overflowLines = 0;
+  u16 worstLine = 0;
+  u16 worstSprites = 0;  // of the lines over a limit
+  u16 worstPixels = 0;
+
+  countSprites(height);
+
+  // each sidebar row reads S when a line in it has too many sprites, P when
+  // only the pixel budget ran out, followed by how many of its lines did
+  for (u16 row = 0; row < height / 8; row++) {
+    u16 overLines = 0;
+    bool spritesOver = FALSE;
+
+    for (u16 line = row * 8; line < row * 8 + 8; line++) {
+      sprites += g_scanlineSpriteDeltas[line];
+      pixels += g_scanlinePixelDeltas[line];
+
+      if (sprites <= spritesMax && pixels <= pixelsMax) {
+        continue;
+      }
+
+      spritesOver |= sprites > spritesMax;
+      overLines++;
+
+      if (sprites > worstSprites ||
+          (sprites == worstSprites && pixels > worstPixels)) {
+        worstLine = line;
+        worstSprites = sprites;
+        worstPixels = pixels;
+      }
+    }
+
+    overflowLines += overLines;
+
+    if (row < SCANLINES_FIRST_ROW) {
+      continue;
+    }
+
+    if (overLines == 0) {
+      setSidebarTile(row, 0, ' ');
+      setSidebarTile(row, 1, ' ');
+    } else {
+      setSidebarTile(row, 0, spritesOver ? 'S' : 'P');
+      setSidebarTile(row, 1, '0' + overLines);
+    }
+  }
+
+  if (worstSprites > 0) {
+    g_scanlinesOverflowFrames++;
+
+    recordScanline(worstLine, worstSprites, worstPixels, _player);
+  }
+
+  // logging is slow enough to cause overflows of its own, so only changes
+  // are reported here and the worst records wait for the tear down
+  if (overflowLines != g_scanlinesOverflowLines) {
+    g_scanlinesOverflowLines = overflowLines;
+
+    log("scanlines: %u lines over the vdp limits", overflowLines);
+  }
+#endif
+}
@@ -0,0 +1,197 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <genesis.h>
+
+#include "actor.h"
+#include "ai_scheduler.h"
+#include "assert.h"
+#include "kernels.h"
+#include "path.h"
+#include "paths.h"
+#include "script.h"
+#include "utilities.h"
+
+// constants
+
+#define SCRIPT_STEPS_MAX 4      // instructions/frame
+#define SCRIPT_HOME_INTERVAL 4  // frames
+#define SCRIPT_OPERATION_NONE 0xFF
+
+// private functions
+
+static u16 readWord(const u8* _code) {
+  return (_code[0] << 8) | _code[1];
+}
+
+static V2f16 getHomingVelocity(const Actor* _actor, ActorHandle _target,
+                               f16 _speed) {
+  const Actor* target = resolveActorHandle(_target);
+  V2f16 velocity = {0, 0};
+
+  // a target that has gone away leaves nothing to steer towards
+  if (target == NULL) {
+    return velocity;
+  }
+
+  const V2f16 position = getActorPosition(_actor);
+  const V2f16 targetPosition = getActorPosition(target);
+  const s16 deltaX = F16_toInt(targetPosition.x) - F16_toInt(position.x);
+  const s16 deltaY = F16_toInt(targetPosition.y) - F16_toInt(position.y);
+  const s16 magnitude = getFastDistance(deltaX, deltaY);
+
+  if (magnitude > 0) {
+    velocity.x = ((s32)deltaX * _speed) / magnitude;
+    velocity.y = ((s32)deltaY * _speed) / magnitude;
+  }
+
+  return velocity;
+}
+
+static bool decode(ScriptRunner* _runner, Actor* _actor,
+                   ScriptFireCallback _fire) {
+  assert(_runner->counter < _runner->script->length, "Script ran off the end");
+
+  const u8* instruction = _runner->script->code + _runner->counter;
+  const u8 operation = instruction[0];
+
+  switch (operation) {
+    case SCRIPT_OP_DESPAWN:
+      return FALSE;
+    case SCRIPT_OP_WAIT:
+      _runner->timer = readWord(instruction + 1);
+      _runner->counter += 3;
+
+      break;
+    case SCRIPT_OP_MOVE:
+      _runner->velocity.x = (s16)readWord(instruction + 1);
+      _runner->velocity.y = (s16)readWord(instruction + 3);
+      _runner->timer = readWord(instruction + 5);
+      _runner->counter += 7;
+
+      break;
+    case SCRIPT_OP_PATH:
+      assert(instruction[1] < PATH_COUNT, "Unknown script path");
+      setUpPathFollower(&_runner->path, k_paths[instruction[1]]);
+
+      _runner->counter += 2;
+
+      break;
+    case SCRIPT_OP_HOME:
+      _runner->speed = (s16)readWord(instruction + 1);
+      _runner->timer = readWord(instruction + 3);
+      _runner->velocity.x = 0;
+      _runner->velocity.y = 0;
+      _runner->counter += 5;
+
+      break;
+    case SCRIPT_OP_FIRE:
+      if (_fire != NULL) {
+        _fire(_actor, instruction[1]);
+      }
+
+      _runner->counter += 2;
+
+      return TRUE;
+    case SCRIPT_OP_JUMP:
+      _runner->counter = readWord(instruction + 1);
+
+      return TRUE;
+    default:
+      assert(FALSE, "Unknown script instruction");
+
+      return FALSE;
+  }
+
+  _runner->operation = operation;
+
+  return TRUE;
+}
+
+// public functions
+
+void setUpScriptRunner(ScriptRunner* _runner, const Script _scripts[]) {
+  // compiled scripts come as one program per frame rate
+  _runner->script = &_scripts[getFrameRateIndex()];
+  _runner->counter = 0;
+  _runner->operation = SCRIPT_OPERATION_NONE;
+  _runner->timer = 0;
+  _runner->velocity.x = 0;
+  _runner->velocity.y = 0;
+  _runner->speed = 0;
+
+  setUpPathFollower(&_runner->path, NULL);
+  setUpAISchedule(&_runner->schedule, SCRIPT_HOME_INTERVAL);
+}
+
+ScriptResult runScript(ScriptRunner* _runner, Actor* _actor,
+                       ActorHandle _target, ScriptFireCallback _fire) {
+  u8 steps = 0;
+
+  // instructions that finish straight away are capped so a script stuck in a
+  // loop can never cost more than SCRIPT_STEPS_MAX decodes a frame
+  while (_runner->operation == SCRIPT_OPERATION_NONE) {
+    if (steps == SCRIPT_STEPS_MAX) {
+      return SCRIPT_RESULT_RUNNING;
+    }
+
+    if (!decode(_runner, _actor, _fire)) {
+      return SCRIPT_RESULT_DESPAWN;
+    }
+
+    steps++;
+  }
+
+  V2f16 position = getActorPosition(_actor);
+  bool done = FALSE;
+
+  switch (_runner->operation) {
+    case SCRIPT_OP_PATH:
+      done = !advancePath(&_runner->path, &position);
+
+      break;
+    case SCRIPT_OP_HOME:
+      if (runAISchedule(&_runner->schedule, _actor)) {
+        _runner->velocity = getHomingVelocity(_actor, _target, _runner->speed);
+      }
+
+      // fall through
+    case SCRIPT_OP_MOVE:
+      position.x = position.x + _runner->velocity.x;
+      position.y = position.y + _runner->velocity.y;
+
+      // fall through
+    default:
+      _runner->timer--;
+      done = _runner->timer == 0;
+
+      break;
+  }
+
+  setActorPosition(_actor, position);
+
+  if (done) {
+    _runner->operation = SCRIPT_OPERATION_NONE;
+  }
+
+  return SCRIPT_RESULT_RUNNING;
+}
@@ -22,11 +22,60 @@
 
 #include <genesis.h>
 
+#include "assert.h"
 #include "camera.h"
 #include "maps.h"
 #include "stage.h"
+#include "tile_mask.h"
 #include "utilities.h"
 
+// constants
+
+#define STAGE_CHUNK_SIZE 128   // pixels
+#define STAGE_LOCAL_LIMIT 511  // pixels
+#define STAGE_SPEED 120        // pixels/second
+
+static const f32 k_stageSpeeds[] = {
+  FIX32(NTSC_PER_FRAME(STAGE_SPEED)),  // ntsc
+  FIX32(PAL_PER_FRAME(STAGE_SPEED))    // pal
+};
+
+// private functions
+
+static s32 getChunkOrigin(f32 _minimumX) {
+  const s32 centerX = F32_toInt(_minimumX) + VDP_getScreenWidth() / 2;
+
+  return centerX & ~(STAGE_CHUNK_SIZE - 1);
+}
+
+static void updateLocalBounds(Stage* _stage) {
+  const V2f32 origin = {
+    FIX32(_stage->origin.x),  // x
+    FIX32(_stage->origin.y)   // y
+  };
+
+  _stage->localMinimum.x = F32_toFix16(_stage->minimumX - origin.x);
+  _stage->localMinimum.y = F32_toFix16(-origin.y);
+  _stage->localMaximum.x = F32_toFix16(_stage->maximumX - origin.x);
+  _stage->localMaximum.y = F32_toFix16(FIX32(_stage->height) - origin.y);
+}
+
+static bool isRegionSolid(const Stage* _stage, s16 _left, s16 _top,
+                          s16 _right, s16 _bottom) {
+  const s16 left = _stage->origin.x + _left;
+  const s16 top = _stage->origin.y + _top;
+  const s16 right = _stage->origin.x + _right;
+  const s16 bottom = _stage->origin.y + _bottom;
+
+  // everything outside the stage counts as solid
+  if (left < 0 || top < 0 || right >= (s16)_stage->width ||
+      bottom >= (s16)_stage->height) {
+    return TRUE;
+  }
+
+  return isTileMaskSolid(&_stage->collision, left, top, right, bottom);
+}
+
 // public functions
 
 void initStage() {
@@ -34,18 +83,29 @@ void initStage() {
 }
 
 void setUpStage(Stage* _stage, u16 _palette) {
-  const u16 attributes = TILE_ATTR(_palette, FALSE, FALSE, FALSE);
+  const u16 tileIndex = TILE_USER_INDEX;
+  const u16 attributes =
+    TILE_ATTR_FULL(_palette, FALSE, FALSE, FALSE, tileIndex);
+
+  VDP_loadTileSet(&k_stage1TileSet, tileIndex, DMA);
 
   _stage->map = MAP_create(&k_stage1Map, BG_B, attributes);
+  _stage->tileIndex = tileIndex + k_stage1TileSet.numTile;
 
-  const f32 fps = FIX32(getFrameRate());
   const f32 screenWidth = FIX32(VDP_getScreenWidth());
 
   _stage->width = k_stage1Map.w * 128;
   _stage->height = k_stage1Map.h * 128;
+
+  setUpTileMask(&_stage->collision, k_stage1Collision);
+
+  assert(_stage->collision.columns * 8 == _stage->width &&
+           _stage->collision.rows * 8 == _stage->height,
+         "Collision mask does not match the stage");
+
   _stage->minimumX = 0;
   _stage->maximumX = _stage->minimumX + screenWidth;
-  _stage->speed = F32_div(FIX32(120), fps);
+  _stage->speed = k_stageSpeeds[getFrameRateIndex()];
 
   const V2f32 position = {
     0,                         // x
@@ -53,6 +113,16 @@ void setUpStage(Stage* _stage, u16 _palette) {
   };
 
   _stage->startPosition = position;
+
+  // fix16 only covers +/-512 pixels so the whole stage height has to fit
+  assert(_stage->height <= STAGE_LOCAL_LIMIT, "Stage too tall for fix16");
+
+  _stage->origin.x = getChunkOrigin(_stage->minimumX);
+  _stage->origin.y = 0;
+  _stage->originShift = 0;
+  _stage->scroll = 0;
+
+  updateLocalBounds(_stage);
 }
 
 void updateStage(Stage* _stage) {
@@ -70,6 +140,19 @@ void updateStage(Stage* _stage) {
   maximumX = clamp(maximumX + speed, maximumXLow, maximumXHigh);
   _stage->minimumX = minimumX;
   _stage->maximumX = maximumX;
+
+  // scroll is measured in the previous chunk so summing it never drifts from
+  // the truncated local bounds
+  const s32 previousOriginX = _stage->origin.x;
+  const s32 originX = getChunkOrigin(minimumX);
+  const f16 previousMinimumX = _stage->localMinimum.x;
+
+  _stage->scroll =
+    F32_toFix16(minimumX - FIX32(previousOriginX)) - previousMinimumX;
+  _stage->origin.x = originX;
+  _stage->originShift = originX - previousOriginX;
+
+  updateLocalBounds(_stage);
 }
 
 void drawStage(const Stage* _stage, const Camera* _camera) {
@@ -81,3 +164,81 @@ void drawStage(const Stage* _stage, const Camera* _camera) {
 void tearDownStage(Stage* _stage) {
   MAP_release(_stage->map);
 }
+
+V2f16 getStageLocalPosition(const Stage* _stage, V2f32 _position) {
+  const V2f32 offset = {
+    _position.x - FIX32(_stage->origin.x),  // x
+    _position.y - FIX32(_stage->origin.y)   // y
+  };
+
+  assert(abs(offset.x) <= FIX32(STAGE_LOCAL_LIMIT) &&
+           abs(offset.y) <= FIX32(STAGE_LOCAL_LIMIT),
+         "Position too far from stage origin");
+
+  const V2f16 position = {
+    F32_toFix16(offset.x),  // x
+    F32_toFix16(offset.y)   // y
+  };
+
+  return position;
+}
+
+V2f32 getStageWorldPosition(const Stage* _stage, V2f16 _position) {
+  const V2f32 position = {
+    FIX32(_stage->origin.x) + F16_toFix32(_position.x),  // x
+    FIX32(_stage->origin.y) + F16_toFix32(_position.y)   // y
+  };
+
+  return position;
+}
+
+bool isStageSolid(const Stage* _stage, V2f16 _position) {
+  const s16 x = F16_toInt(_position.x);
+  const s16 y = F16_toInt(_position.y);
+
+  return isRegionSolid(_stage, x, y, x, y);
+}
+
+V2f16 resolveStageMovement(const Stage* _stage, V2f16 _from, V2f16 _to,
+                           V2s16 _extent) {
+  V2f16 position = _from;
+  const s16 fromX = F16_toInt(_from.x);
+  const s16 fromY = F16_toInt(_from.y);
+  const s16 toX = F16_toInt(_to.x);
+  const s16 toY = F16_toInt(_to.y);
+  s16 left = fromX - _extent.x;
+  s16 right = fromX + _extent.x - 1;
+  const s16 top = fromY - _extent.y;
+  const s16 bottom = fromY + _extent.y - 1;
+  bool blocked = FALSE;
+
+  // axes are resolved one at a time so movement slides along walls and only
+  // the pixels the leading edge sweeps into get tested
+  if (toX > fromX) {
+    blocked = isRegionSolid(_stage, right + 1, top, toX + _extent.x - 1,
+                            bottom);
+  } else if (toX < fromX) {
+    blocked = isRegionSolid(_stage, toX - _extent.x, top, left - 1, bottom);
+  }
+
+  if (!blocked) {
+    position.x = _to.x;
+    left = toX - _extent.x;
+    right = toX + _extent.x - 1;
+  }
+
+  blocked = FALSE;
+
+  if (toY > fromY) {
+    blocked = isRegionSolid(_stage, left, bottom + 1, right,
+                            toY + _extent.y - 1);
+  } else if (toY < fromY) {
+    blocked = isRegionSolid(_stage, left, toY - _extent.y, right, top - 1);
+  }
+
+  if (!blocked) {
+    position.y = _to.y;
+  }
+
+  return position;
+}
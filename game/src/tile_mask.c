@@ -0,0 +1,64 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <genesis.h>
+
+#include "tile_mask.h"
+
+// constants
+
+#define TILE_MASK_TILE_SHIFT 3  // 8x8 pixel tiles
+
+// public functions
+
+void setUpTileMask(TileMask* _mask, const u8* _data) {
+  // baked by tools/collision.py, a big-endian size header then the bitmap
+  _mask->columns = (_data[0] << 8) | _data[1];
+  _mask->rows = (_data[2] << 8) | _data[3];
+  _mask->stride = (_mask->columns + 7) >> 3;
+  _mask->bits = _data + 4;
+}
+
+bool isTileMaskSolid(const TileMask* _mask, s16 _left, s16 _top, s16 _right,
+                     s16 _bottom) {
+  // pixels are inclusive and relative to the top left of the mask, anything
+  // outside of it is empty
+  const s16 firstColumn = max(_left >> TILE_MASK_TILE_SHIFT, 0);
+  const s16 lastColumn =
+    min(_right >> TILE_MASK_TILE_SHIFT, (s16)_mask->columns - 1);
+  const s16 firstRow = max(_top >> TILE_MASK_TILE_SHIFT, 0);
+  const s16 lastRow =
+    min(_bottom >> TILE_MASK_TILE_SHIFT, (s16)_mask->rows - 1);
+  const u8* row = _mask->bits + firstRow * _mask->stride;
+
+  for (s16 y = firstRow; y <= lastRow; y++) {
+    for (s16 x = firstColumn; x <= lastColumn; x++) {
+      if (row[x >> 3] & (0x80 >> (x & 7))) {
+        return TRUE;
+      }
+    }
+
+    row += _mask->stride;
+  }
+
+  return FALSE;
+}
@@ -0,0 +1,60 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <genesis.h>
+
+#include "trace.h"
+
+// global properties
+
+#ifdef TRACE_ENABLED
+// read back from a RAM dump by tools/trace.py
+static TraceBuffer g_trace;
+#endif
+
+// public functions
+
+void initTrace() {
+#ifdef TRACE_ENABLED
+  memset(&g_trace, 0, sizeof(g_trace));
+
+  g_trace.magic = TRACE_MAGIC;
+#endif
+}
+
+void writeTrace(TraceEvent _event, u16 _argument1, u16 _argument2) {
+#ifdef TRACE_ENABLED
+  const u16 head = g_trace.head;
+  TraceRecord* record = &g_trace.records[head];
+
+  record->frame = vtimer;
+  record->event = _event;
+  record->argument1 = _argument1;
+  record->argument2 = _argument2;
+
+  g_trace.head = (head + 1) & (TRACE_RECORDS - 1);
+
+  if (g_trace.count < TRACE_RECORDS) {
+    g_trace.count++;
+  }
+#endif
+}
@@ -22,25 +22,38 @@
 
 #include <genesis.h>
 
+#include "hot_data.h"
 #include "utilities.h"
 
 // constants
 
-#define PAL_FRAME_RATE 50
-#define NTSC_FRAME_RATE 60
+#define UTILITIES_FRAME_TICKS_MAX 3  // ticks
+
+static const u8 k_frameRates[] = {
+  NTSC_FRAME_RATE,  // ntsc
+  PAL_FRAME_RATE    // pal
+};
+static const f32 k_frameDeltaTimes[] = {
+  FIX32(NTSC_PER_FRAME(1)),  // ntsc
+  FIX32(PAL_PER_FRAME(1))    // pal
+};
 
 // global properties
 
 static u8 g_utiltiesFrameRate;
 static f32 g_utiltiesFrameDeltaTime;
+static u32 g_utiltiesFrameTicksTimer;
 
 // public functions
 
 void initUtilities() {
-  const u8 fps = IS_PAL_SYSTEM ? PAL_FRAME_RATE : NTSC_FRAME_RATE;
+  const u8 index = IS_PAL_SYSTEM ? FRAME_RATE_INDEX_PAL : FRAME_RATE_INDEX_NTSC;
+
+  HOT_DATA.frameRateIndex = index;
+  g_utiltiesFrameRate = k_frameRates[index];
+  g_utiltiesFrameDeltaTime = k_frameDeltaTimes[index];
 
-  g_utiltiesFrameRate = fps;
-  g_utiltiesFrameDeltaTime = F32_div(FIX32(1), FIX32(fps));
+  resetFrameTicks();
 }
 
 void showText(char _text[], u8 _column) {
@@ -55,6 +68,10 @@ u8 getFrameRate() {
   return g_utiltiesFrameRate;
 }
 
+u8 getFrameRateIndex() {
+  return HOT_DATA.frameRateIndex;
+}
+
 f32 getFrameDeltaTime() {
   return g_utiltiesFrameDeltaTime;
 }
@@ -62,3 +79,18 @@ f32 getFrameDeltaTime() {
 u16 secondsToFrames(f16 _seconds) {
   return F16_toRoundedInt(F16_mul(_seconds, FIX16(getFrameRate())));
 }
+
+void resetFrameTicks() {
+  g_utiltiesFrameTicksTimer = vtimer;
+}
+
+u8 getFrameTicks() {
+  const u32 timer = vtimer;
+  const u32 ticks = timer - g_utiltiesFrameTicksTimer;
+
+  g_utiltiesFrameTicksTimer = timer;
+
+  // anything past the bound is dropped, catching up on it all would only
+  // cause more lag
+  return clamp(ticks, 1, UTILITIES_FRAME_TICKS_MAX);
+}
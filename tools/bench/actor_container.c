@@ -0,0 +1,395 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Stress benchmark for the actor container, run on the host. Every container
+// goes through the same seeded churn at 32, 64, 128 and 256 live actors:
+//
+//   steady   a sixteenth of the actors die and respawn every frame
+//   burst    a full wave spawns in one frame, then dies off over a second
+//   mass     everything dies in one frame and respawns the next
+//
+// and the report gives the time per spawn, per kill and per actor for the
+// update and draw passes, plus how the memory behind the container fragments
+// over the run: how far the arena gets bumped, how much of that sits on the
+// free lists waiting for a record of its size, and how much of it is not
+// holding a live actor.
+//
+//   cc -O2 -DACTOR_HANDLES_MAX=256 -DARENA_SIZE=32768 -Itools/bench/host
+//      -Igame/inc -o actor_container tools/bench/actor_container.c
+//      game/src/managed_actor.c game/src/actor.c game/src/arena.c
+//      game/src/camera.c game/src/hot_data.c game/src/kernels.c
+//   ./actor_container
+//
+// The handle table and arena are raised on the command line so the larger
+// counts run at all, the console builds keep 64 actors and 8 KB. Sizes are
+// the host's, where pointers are wider than on the 68000, so memory figures
+// compare containers rather than predict the console. A replacement
+// container is benchmarked by adding an entry to k_containers.
+
+#include <genesis.h>
+
+#include <stdio.h>
+#include <time.h>
+
+#include "actor.h"
+#include "arena.h"
+#include "camera.h"
+#include "hot_data.h"
+#include "managed_actor.h"
+#include "stage.h"
+
+// constants
+
+#define FRAMES 3600  // a minute at 60 Hz
+#define SEED 0x2545F491
+#define ACTORS_MAX 256
+
+static const u16 k_actorCounts[] = {32, 64, 128, 256};
+
+// entity
+
+typedef enum {
+  PATTERN_STEADY,
+  PATTERN_BURST,
+  PATTERN_MASS,
+  PATTERN_COUNT
+} Pattern;
+
+typedef struct {
+  const char* name;
+  u16 capacity;  // live actors it can hold at once
+  void (*reset)();
+  Actor* (*spawn)(V2f16 _position);
+  void (*kill)(Actor* _actor);
+  void (*update)(const Stage* _stage);
+  void (*draw)(const Camera* _camera);
+  u32 (*getBytesUsed)();
+  u32 (*getBytesFree)();
+  u32 (*getBytesParked)();    // freed, waiting to be reused
+  u32 (*getBytesReserved)();  // ever handed out since the reset
+} Container;
+
+typedef struct {
+  double spawnTime;  // seconds
+  double killTime;
+  double updateTime;
+  double drawTime;
+  u32 spawns;
+  u32 failures;  // spawns the container turned down
+  u32 kills;
+  u32 actorUpdates;  // one per live actor per frame
+  u32 bytesHighWater;  // reserved
+  u32 bytesParkedMax;
+  double slack;  // summed over frames, divided by FRAMES at the end
+  double slackMax;
+  u16 resets;
+} Result;
+
+// global properties
+
+static const char* const k_patternNames[] = {"steady", "burst", "mass"};
+
+static Actor* g_live[ACTORS_MAX];
+static u16 g_liveCount;
+static u32 g_bytesPerActor;  // learned from the first spawn
+static u32 g_random;
+static u16 g_frame;
+
+// managed actor container
+
+static void updateBenchActor(Actor* _actor, const Stage* _stage) {
+  V2f16 position = getActorPosition(_actor);
+
+  position.x += FIX16(0.25);
+
+  setActorPosition(_actor, position);
+}
+
+static void resetManagedActors() {
+  initManagedActors();
+  initActors();
+  tearDownArena();
+  setUpArena();
+}
+
+static Actor* spawnManagedActor(V2f16 _position) {
+  return createManagedActor(_position, NULL, &updateBenchActor, NULL, NULL);
+}
+
+static u32 getManagedBytesUsed() {
+  return getArenaUsed();
+}
+
+static u32 getManagedBytesFree() {
+  return getArenaFree();
+}
+
+static u32 getManagedBytesParked() {
+  return getArenaRecycled();
+}
+
+static u32 getManagedBytesReserved() {
+  return getArenaReserved();
+}
+
+static const Container k_containers[] = {
+  {"managed_actor.c, arena", ACTOR_HANDLES_MAX, &resetManagedActors,
+   &spawnManagedActor, &setManagedActorCleanUp, &updateManagedActors,
+   &drawManagedActors, &getManagedBytesUsed, &getManagedBytesFree,
+   &getManagedBytesParked, &getManagedBytesReserved}
+};
+
+// private functions
+
+static u32 getRandom() {
+  g_random ^= g_random << 13;
+  g_random ^= g_random >> 17;
+  g_random ^= g_random << 5;
+
+  return g_random;
+}
+
+static double getSeconds() {
+  struct timespec time;
+
+  clock_gettime(CLOCK_MONOTONIC, &time);
+
+  return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+static void resetScene(const Container* _container) {
+  _container->reset();
+
+  g_liveCount = 0;
+}
+
+static void spawn(const Container* _container, u16 _count, Result* _result) {
+  u16 count = min(_count, _container->capacity - g_liveCount);
+
+  // a full container would fail, a real scene would be reloaded instead
+  if (g_bytesPerActor > 0 &&
+      _container->getBytesFree() < count * g_bytesPerActor) {
+    _result->resets++;
+    resetScene(_container);
+    count = min(_count, _container->capacity);
+  }
+
+  const u32 used = _container->getBytesUsed();
+  const double start = getSeconds();
+
+  u16 spawned = 0;
+
+  for (; spawned < count; spawned++) {
+    const V2f16 position = {
+      FIX16((s16)(getRandom() % 512) - 96),  // x
+      FIX16((s16)(getRandom() % 320) - 48)   // y
+    };
+    Actor* actor = _container->spawn(position);
+
+    // out of handles or memory, the container turned it down
+    if (actor == NULL) {
+      _result->failures += count - spawned;
+
+      break;
+    }
+
+    g_live[g_liveCount++] = actor;
+  }
+
+  _result->spawnTime += getSeconds() - start;
+  _result->spawns += spawned;
+
+  if (g_bytesPerActor == 0 && count > 0) {
+    g_bytesPerActor = (_container->getBytesUsed() - used) / count;
+  }
+}
+
+static void kill(const Container* _container, u16 _count, Result* _result) {
+  const u16 count = min(_count, g_liveCount);
+  const double start = getSeconds();
+
+  for (u16 i = 0; i < count; i++) {
+    const u16 index = getRandom() % g_liveCount;
+
+    _container->kill(g_live[index]);
+
+    g_live[index] = g_live[--g_liveCount];
+  }
+
+  _result->killTime += getSeconds() - start;
+  _result->kills += count;
+}
+
+static void runFrame(const Container* _container, Pattern _pattern,
+                     u16 _actors, u16 _frame, Result* _result) {
+  switch (_pattern) {
+    case PATTERN_STEADY:
+      // dead actors hold their handle until the update collects them, so
+      // the replacements come in first
+      spawn(_container, _actors - g_liveCount, _result);
+      kill(_container, _actors / 16, _result);
+
+      break;
+    case PATTERN_BURST:
+      if (_frame % 60 == 0) {
+        spawn(_container, _actors, _result);
+      } else {
+        kill(_container, (_actors + 58) / 59, _result);
+      }
+
+      break;
+    case PATTERN_MASS:
+      if (_frame % 30 == 0) {
+        kill(_container, g_liveCount, _result);
+      } else {
+        spawn(_container, _actors - g_liveCount, _result);
+      }
+
+      break;
+    default:
+      break;
+  }
+}
+
+static Result runPattern(const Container* _container, Pattern _pattern,
+                         u16 _actors) {
+  Stage stage;
+  Camera camera;
+  Result result;
+
+  memset(&stage, 0, sizeof(stage));
+  memset(&camera, 0, sizeof(camera));
+  memset(&result, 0, sizeof(result));
+
+  // nothing ever falls behind the stage, actors only go when killed, and the
+  // limit behind it still has to fit in an f16
+  stage.localMinimum.x = FIX16(-256);
+  camera.view.localMinimum.x = 0;
+  camera.view.localMinimum.y = 0;
+  camera.view.localMaximum.x = VDP_getScreenWidth();
+  camera.view.localMaximum.y = VDP_getScreenHeight();
+
+  g_random = SEED;
+  g_bytesPerActor = 0;
+  resetScene(_container);
+
+  for (g_frame = 0; g_frame < FRAMES; g_frame++) {
+    runFrame(_container, _pattern, _actors, g_frame, &result);
+
+    double start = getSeconds();
+
+    _container->update(&stage);
+
+    result.updateTime += getSeconds() - start;
+    result.actorUpdates += g_liveCount;
+
+    start = getSeconds();
+    _container->draw(&camera);
+    result.drawTime += getSeconds() - start;
+
+    // dead actors are collected now, whatever was bumped past beyond the
+    // live ones is only any use to a record of the same size
+    const u32 reserved = _container->getBytesReserved();
+    const u32 parked = _container->getBytesParked();
+    const u32 live = g_liveCount * g_bytesPerActor;
+    const double slack =
+      reserved > 0 && reserved > live ? 1 - (double)live / reserved : 0;
+
+    result.bytesHighWater = max(result.bytesHighWater, reserved);
+    result.bytesParkedMax = max(result.bytesParkedMax, parked);
+    result.slack += slack;
+    result.slackMax = max(result.slackMax, slack);
+  }
+
+  resetScene(_container);
+
+  return result;
+}
+
+static double getNanoseconds(double _seconds, u32 _count) {
+  return _count > 0 ? _seconds / _count * 1e9 : 0;
+}
+
+static void printResult(const char* _pattern, u16 _actors,
+                        const Result* _result) {
+  printf("  %-7s %4u %8.1f %8.1f %8.1f %8.1f %8u %8u %6.1f%% %6.1f%%\n",
+         _pattern, _actors, getNanoseconds(_result->spawnTime, _result->spawns),
+         getNanoseconds(_result->killTime, _result->kills),
+         getNanoseconds(_result->updateTime, _result->actorUpdates),
+         getNanoseconds(_result->drawTime, _result->actorUpdates),
+         _result->bytesHighWater, _result->bytesParkedMax,
+         _result->slack / FRAMES * 100, _result->slackMax * 100);
+
+  if (_result->resets > 0) {
+    printf("  %-7s %4u %u scene resets\n", _pattern, _actors,
+           _result->resets);
+  }
+
+  if (_result->failures > 0) {
+    printf("  %-7s %4u %u spawns failed\n", _pattern, _actors,
+           _result->failures);
+  }
+}
+
+static void runContainer(const Container* _container) {
+  printf("%s, %u frames, capacity %u actors\n", _container->name, FRAMES,
+         _container->capacity);
+  printf("  %-7s %4s %8s %8s %8s %8s %8s %8s %7s %7s\n", "pattern", "live",
+         "spawn", "kill", "update", "draw", "bumped", "parked", "slack",
+         "worst");
+
+  for (u8 i = 0; i < sizeof(k_actorCounts) / sizeof(u16); i++) {
+    const u16 actors = k_actorCounts[i];
+
+    for (Pattern pattern = 0; pattern < PATTERN_COUNT; pattern++) {
+      if (actors > _container->capacity) {
+        printf("  %-7s %4u over capacity\n", k_patternNames[pattern], actors);
+
+        continue;
+      }
+
+      const Result result = runPattern(_container, pattern, actors);
+
+      printResult(k_patternNames[pattern], actors, &result);
+    }
+  }
+
+  printf("  times in ns, update and draw per live actor, bumped is the arena "
+         "high water mark,\n  parked the most bytes on the free lists at "
+         "once, slack the mean share of the\n  bumped bytes not holding a "
+         "live actor\n\n");
+}
+
+// program entry
+
+int main() {
+  initHotData(TRUE);
+  initArena();
+  initActors();
+  initManagedActors();
+
+  for (u8 i = 0; i < sizeof(k_containers) / sizeof(Container); i++) {
+    runContainer(&k_containers[i]);
+  }
+
+  return 0;
+}
@@ -0,0 +1,378 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Accuracy and cost of the fixed point helpers gameplay leans on, measured on
+// the host over the input ranges the game feeds them. Each group runs the
+// helper the game uses today first, then the candidates that could replace
+// it, and reports the largest and mean error against double precision and the
+// time per call relative to the first entry.
+//
+//   cc -O2 -Itools/bench/host -Igame/inc -o fixed_point
+//      tools/bench/fixed_point.c game/src/kernels.c game/src/actor.c
+//      game/src/arena.c -lm
+//   ./fixed_point
+//
+// Host timings rank candidates, they do not predict 68000 cycles, where a
+// divide costs well over a hundred cycles and a multiply around seventy. The
+// DEBUG boot log times the assembly kernels on the console itself.
+
+#include <genesis.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "kernels.h"
+
+// constants
+
+#define SAMPLES_PER_AXIS 1001
+#define SAMPLES_MAX (SAMPLES_PER_AXIS * SAMPLES_PER_AXIS)
+#define TIMING_RUNS 20
+#define HYPOT_STEPS 64           // table entries over 0 to 1
+#define HYPOT_ONE 16384          // table scale
+#define HOMING_REACH FIX16(112)  // homing radius plus the player's
+#define ACTOR_REACH 65535        // any two f16 positions
+#define SCRIPT_REACH 512         // pixels
+
+// entity
+
+typedef s32 (*Kernel)(s32 _a, s32 _b);
+
+// error of a kernel result, in whatever unit the group reports
+typedef double (*ErrorFunction)(s32 _result, s32 _a, s32 _b);
+
+typedef struct {
+  const char* name;
+  Kernel kernel;
+} Candidate;
+
+typedef struct {
+  const char* name;
+  const char* unit;
+  s32 minimumA;
+  s32 maximumA;
+  s32 minimumB;
+  s32 maximumB;
+  ErrorFunction error;
+  const Candidate* candidates;
+  u8 candidateCount;
+} Group;
+
+// global properties
+
+static u16 g_hypot[HYPOT_STEPS + 1];  // sqrt(1 + t * t), t = index / steps
+static s32 g_samplesA[SAMPLES_MAX];
+static s32 g_samplesB[SAMPLES_MAX];
+static volatile s32 g_sink;  // keeps timed calls from being optimized away
+
+// distance kernels
+
+static s32 runSgdkDistance(s32 _deltaX, s32 _deltaY) {
+  return getApproximatedDistance(_deltaX, _deltaY);
+}
+
+// the longer side scaled by sqrt(1 + t * t) for the ratio t of the sides,
+// one divide and one multiply
+static s32 runLookUpDistance(s32 _deltaX, s32 _deltaY) {
+  const u32 x = _deltaX < 0 ? -_deltaX : _deltaX;
+  const u32 y = _deltaY < 0 ? -_deltaY : _deltaY;
+  const u32 longer = x > y ? x : y;
+  const u32 shorter = x > y ? y : x;
+
+  if (longer == 0) {
+    return 0;
+  }
+
+  const u32 index = (shorter * HYPOT_STEPS + (longer >> 1)) / longer;
+
+  return (longer * g_hypot[index] + HYPOT_ONE / 2) / HYPOT_ONE;
+}
+
+// x and y of the normalized direction actor.c builds, as a squared length
+static s32 normalize(s32 _deltaX, s32 _deltaY, s32 _magnitude) {
+  if (_magnitude == 0) {
+    return FIX16(1) * FIX16(1);
+  }
+
+  const s32 x = (_deltaX << FIX16_FRAC_BITS) / _magnitude;
+  const s32 y = (_deltaY << FIX16_FRAC_BITS) / _magnitude;
+
+  return x * x + y * y;
+}
+
+static s32 runSgdkDirection(s32 _deltaX, s32 _deltaY) {
+  return normalize(_deltaX, _deltaY,
+                   getApproximatedDistance(_deltaX, _deltaY));
+}
+
+static s32 runLookUpDirection(s32 _deltaX, s32 _deltaY) {
+  return normalize(_deltaX, _deltaY, runLookUpDistance(_deltaX, _deltaY));
+}
+
+// multiply and divide kernels
+
+static s32 runF16Mul(s32 _a, s32 _b) {
+  return F16_mul((f16)_a, (f16)_b);
+}
+
+static s32 runF16MulRounded(s32 _a, s32 _b) {
+  return ((f16)_a * (f16)_b + FIX16(0.5)) >> FIX16_FRAC_BITS;
+}
+
+// the homing mine divides a delta by the distance it is within
+static s32 runF16Div(s32 _a, s32 _b) {
+  return F16_div((f16)(_a % _b), (f16)_b);
+}
+
+static s32 runF16DivRounded(s32 _a, s32 _b) {
+  const s32 a = (_a % _b) << FIX16_FRAC_BITS;
+
+  return (a + (a < 0 ? -_b : _b) / 2) / _b;
+}
+
+static s32 runF32Mul(s32 _a, s32 _b) {
+  return F32_mul(_a, _b);
+}
+
+static s32 runF32MulWide(s32 _a, s32 _b) {
+  return ((int64_t)_a * _b) >> FIX32_FRAC_BITS;
+}
+
+static s32 runF32Div(s32 _a, s32 _b) {
+  return F32_div(_a, _b);
+}
+
+static s32 runF32DivWide(s32 _a, s32 _b) {
+  return ((int64_t)_a << FIX32_FRAC_BITS) / _b;
+}
+
+// conversion kernels, the second input is unused
+
+static s32 runF16ToInt(s32 _a, s32 _b) {
+  return F16_toInt((f16)_a);
+}
+
+static s32 runF16ToRoundedInt(s32 _a, s32 _b) {
+  return F16_toRoundedInt((f16)_a);
+}
+
+// error functions
+
+static double getDistanceError(s32 _result, s32 _a, s32 _b) {
+  const double exact = hypot(_a, _b);
+
+  return exact == 0 ? 0 : (_result - exact) / exact * 100;
+}
+
+static double getDirectionError(s32 _result, s32 _a, s32 _b) {
+  return (sqrt(_result) / FIX16(1) - 1) * 100;
+}
+
+static double getF16MulError(s32 _result, s32 _a, s32 _b) {
+  return _result - (double)_a * _b / FIX16(1);
+}
+
+static double getF16DivError(s32 _result, s32 _a, s32 _b) {
+  return _result - (double)(_a % _b) * FIX16(1) / _b;
+}
+
+static double getF32MulError(s32 _result, s32 _a, s32 _b) {
+  return _result - (double)_a * _b / FIX32(1);
+}
+
+static double getF32DivError(s32 _result, s32 _a, s32 _b) {
+  return _result - (double)_a * FIX32(1) / _b;
+}
+
+static double getF16ToIntError(s32 _result, s32 _a, s32 _b) {
+  return _result - (double)_a / FIX16(1);
+}
+
+// groups
+
+static const Candidate k_distanceCandidates[] = {
+  {"getApproximatedDistance", &runSgdkDistance},
+  {"hypot table", &runLookUpDistance}
+};
+static const Candidate k_directionCandidates[] = {
+  {"getApproximatedDistance", &runSgdkDirection},
+  {"hypot table", &runLookUpDirection}
+};
+static const Candidate k_f16MulCandidates[] = {
+  {"F16_mul", &runF16Mul},
+  {"rounded", &runF16MulRounded}
+};
+static const Candidate k_f16DivCandidates[] = {
+  {"F16_div", &runF16Div},
+  {"rounded", &runF16DivRounded}
+};
+static const Candidate k_f32MulCandidates[] = {
+  {"F32_mul", &runF32Mul},
+  {"64-bit", &runF32MulWide}
+};
+static const Candidate k_f32DivCandidates[] = {
+  {"F32_div", &runF32Div},
+  {"64-bit", &runF32DivWide}
+};
+static const Candidate k_f16ToIntCandidates[] = {
+  {"F16_toInt", &runF16ToInt},
+  {"F16_toRoundedInt", &runF16ToRoundedInt}
+};
+
+#define CANDIDATES(_candidates)                                                \
+  (_candidates), sizeof(_candidates) / sizeof(Candidate)
+
+static const Group k_groups[] = {
+  {"distance, actor.c", "%", -ACTOR_REACH, ACTOR_REACH, -ACTOR_REACH,
+   ACTOR_REACH, &getDistanceError, CANDIDATES(k_distanceCandidates)},
+  {"distance, homing mine", "%", -HOMING_REACH, HOMING_REACH, -HOMING_REACH,
+   HOMING_REACH, &getDistanceError, CANDIDATES(k_distanceCandidates)},
+  {"distance, script homing", "%", -SCRIPT_REACH, SCRIPT_REACH, -SCRIPT_REACH,
+   SCRIPT_REACH, &getDistanceError, CANDIDATES(k_distanceCandidates)},
+  {"direction length, actor.c", "%", -ACTOR_REACH, ACTOR_REACH, -ACTOR_REACH,
+   ACTOR_REACH, &getDirectionError, CANDIDATES(k_directionCandidates)},
+  {"velocity, direction * speed", "1/64 px", -FIX16(1), FIX16(1), 0,
+   FIX16(4), &getF16MulError, CANDIDATES(k_f16MulCandidates)},
+  {"direction, delta / distance", "1/64", -HOMING_REACH, HOMING_REACH, 1,
+   HOMING_REACH, &getF16DivError, CANDIDATES(k_f16DivCandidates)},
+  {"f32 multiply", "1/1024", -FIX32(512), FIX32(512), -FIX32(4), FIX32(4),
+   &getF32MulError, CANDIDATES(k_f32MulCandidates)},
+  {"fade step, distance / frames", "1/1024", 0, FIX32(255), FIX32(1),
+   FIX32(120), &getF32DivError, CANDIDATES(k_f32DivCandidates)},
+  {"f16 to pixels", "px", -32768, 32767, 0, 0, &getF16ToIntError,
+   CANDIDATES(k_f16ToIntCandidates)}
+};
+
+// private functions
+
+static void setUpHypotTable() {
+  for (u16 i = 0; i <= HYPOT_STEPS; i++) {
+    const double t = (double)i / HYPOT_STEPS;
+
+    g_hypot[i] = (u16)lround(sqrt(1 + t * t) * HYPOT_ONE);
+  }
+}
+
+static s32 getSample(s32 _minimum, s32 _maximum, u32 _index, u32 _count) {
+  if (_count == 1) {
+    return _minimum;
+  }
+
+  return _minimum +
+         (s32)(((int64_t)_maximum - _minimum) * _index / (_count - 1));
+}
+
+// an even grid over both ranges, when the second input is unused every value
+// of the first one fits in the samples instead
+static u32 setUpSamples(const Group* _group) {
+  const int64_t range = (int64_t)_group->maximumA - _group->minimumA + 1;
+  u32 columns = SAMPLES_PER_AXIS;
+  u32 rows = SAMPLES_PER_AXIS;
+  u32 count = 0;
+
+  if (_group->minimumB == _group->maximumB) {
+    columns = range < SAMPLES_MAX ? range : SAMPLES_MAX;
+    rows = 1;
+  }
+
+  for (u32 i = 0; i < columns; i++) {
+    for (u32 j = 0; j < rows; j++) {
+      g_samplesA[count] =
+        getSample(_group->minimumA, _group->maximumA, i, columns);
+      g_samplesB[count] =
+        getSample(_group->minimumB, _group->maximumB, j, rows);
+      count++;
+    }
+  }
+
+  return count;
+}
+
+static double getSeconds() {
+  struct timespec time;
+
+  clock_gettime(CLOCK_MONOTONIC, &time);
+
+  return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+static double timeKernel(Kernel _kernel, u32 _count) {
+  const double start = getSeconds();
+
+  for (u16 run = 0; run < TIMING_RUNS; run++) {
+    for (u32 i = 0; i < _count; i++) {
+      g_sink = _kernel(g_samplesA[i], g_samplesB[i]);
+    }
+  }
+
+  return (getSeconds() - start) / ((double)TIMING_RUNS * _count) * 1e9;
+}
+
+static void runGroup(const Group* _group) {
+  const u32 count = setUpSamples(_group);
+  double baseline = 0;
+
+  printf("%s, %u samples, error in %s\n", _group->name, count, _group->unit);
+  printf("  %-24s %10s %10s %10s %8s %6s\n", "", "max", "mean", "bias",
+         "ns/call", "cost");
+
+  for (u8 i = 0; i < _group->candidateCount; i++) {
+    const Candidate* candidate = &_group->candidates[i];
+    double worst = 0;
+    double total = 0;
+    double bias = 0;
+
+    for (u32 j = 0; j < count; j++) {
+      const s32 a = g_samplesA[j];
+      const s32 b = g_samplesB[j];
+      const double error = _group->error(candidate->kernel(a, b), a, b);
+
+      worst = fmax(worst, fabs(error));
+      total += fabs(error);
+      bias += error;
+    }
+
+    const double time = timeKernel(candidate->kernel, count);
+
+    if (i == 0) {
+      baseline = time;
+    }
+
+    printf("  %-24s %10.4f %10.4f %+10.4f %8.2f %5.2fx\n", candidate->name,
+           worst, total / count, bias / count, time, time / baseline);
+  }
+
+  printf("\n");
+}
+
+// program entry
+
+int main() {
+  setUpHypotTable();
+
+  for (u8 i = 0; i < sizeof(k_groups) / sizeof(Group); i++) {
+    runGroup(&k_groups[i]);
+  }
+
+  return 0;
+}
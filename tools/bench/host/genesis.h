@@ -0,0 +1,119 @@
+// MIT License
+//
+// Copyright (c) 2026 Devon Powell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Just enough of SGDK to build game modules on the host for the benchmarks in
+// tools/bench. Types keep their Mega Drive sizes and the fixed point helpers
+// do the same integer arithmetic as SGDK's maths.h and maths.c, keep them in
+// step when the submodule moves.
+
+#ifndef __QUANTUM_BURST_HOST_GENESIS_H__
+#define __QUANTUM_BURST_HOST_GENESIS_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// types
+
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef u8 bool;
+
+typedef s16 f16;
+typedef s32 f32;
+
+typedef struct {
+  s16 x;
+  s16 y;
+} V2s16;
+
+typedef struct {
+  s32 x;
+  s32 y;
+} V2s32;
+
+typedef struct {
+  f16 x;
+  f16 y;
+} V2f16;
+
+typedef struct {
+  f32 x;
+  f32 y;
+} V2f32;
+
+typedef struct Map Map;
+
+#define TRUE 1
+#define FALSE 0
+
+// maths
+
+#define FIX16_FRAC_BITS 6
+#define FIX32_FRAC_BITS 10
+
+#define FIX16(_value) ((f16)((_value) * (1 << FIX16_FRAC_BITS)))
+#define FIX32(_value) ((f32)((_value) * (1 << FIX32_FRAC_BITS)))
+
+#define F16_toInt(_value) ((_value) >> FIX16_FRAC_BITS)
+#define F16_toRoundedInt(_value) F16_toInt((_value) + (FIX16(0.5) - 1))
+#define F32_toInt(_value) ((_value) >> FIX32_FRAC_BITS)
+#define F32_toRoundedInt(_value) F32_toInt((_value) + (FIX32(0.5) - 1))
+
+#define F16_mul(_value1, _value2) (((_value1) * (_value2)) >> FIX16_FRAC_BITS)
+#define F16_div(_value1, _value2) (((_value1) << FIX16_FRAC_BITS) / (_value2))
+#define F32_mul(_value1, _value2)                                              \
+  (((_value1) >> (FIX32_FRAC_BITS / 2)) * ((_value2) >> (FIX32_FRAC_BITS / 2)))
+#define F32_div(_value1, _value2)                                              \
+  (((_value1) << (FIX32_FRAC_BITS / 2)) / ((_value2) >> (FIX32_FRAC_BITS / 2)))
+
+#define abs(_value) ((_value) < 0 ? -(_value) : (_value))
+#define min(_value1, _value2) ((_value1) < (_value2) ? (_value1) : (_value2))
+#define max(_value1, _value2) ((_value1) > (_value2) ? (_value1) : (_value2))
+
+// 123/128 of the longer side plus 51/128 of the shorter one, as in maths.c
+static inline u32 getApproximatedDistance(s32 _deltaX, s32 _deltaY) {
+  const u32 x = _deltaX < 0 ? -_deltaX : _deltaX;
+  const u32 y = _deltaY < 0 ? -_deltaY : _deltaY;
+  const u32 longer = x < y ? y : x;
+  const u32 shorter = x < y ? x : y;
+
+  return ((longer << 8) + (longer << 3) - (longer << 4) - (longer << 1) +
+          (shorter << 7) - (shorter << 5) + (shorter << 3) - (shorter << 1)) >>
+         8;
+}
+
+// video
+
+static inline u16 VDP_getScreenWidth() {
+  return 320;
+}
+
+static inline u16 VDP_getScreenHeight() {
+  return 224;
+}
+
+#endif  // __QUANTUM_BURST_HOST_GENESIS_H__
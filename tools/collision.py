@@ -0,0 +1,91 @@
+# MIT License
+#
+# Copyright (c) 2026 Devon Powell
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Bake a per-tile collision bitmap from an indexed map image.
+
+Every 8x8 tile that contains at least one pixel using a solid palette index is
+marked solid, or any non-transparent pixel when building a mask for an image
+such as a boss. The output is a big-endian header of the width and height in
+tiles followed by one bit per tile, rows padded to whole bytes and the most
+significant bit being the left-most tile. It is pulled into the ROM as a
+rescomp BIN resource so the game can answer collision queries without touching
+the compressed map data.
+"""
+
+import argparse
+import struct
+import sys
+
+import indexed_png
+
+TILE_SIZE = 8
+
+
+def bake(width, height, pixels, solid):
+  if width % TILE_SIZE != 0 or height % TILE_SIZE != 0:
+    raise ValueError('image size must be a multiple of the tile size')
+
+  columns = width // TILE_SIZE
+  rows = height // TILE_SIZE
+  stride = (columns + 7) // 8
+  bitmap = bytearray(stride * rows)
+
+  for row in range(rows):
+    for column in range(columns):
+      top = row * TILE_SIZE
+      left = column * TILE_SIZE
+
+      if any(pixels[top + y][left + x] in solid
+             for y in range(TILE_SIZE) for x in range(TILE_SIZE)):
+        bitmap[row * stride + column // 8] |= 0x80 >> (column % 8)
+
+  return struct.pack('>HH', columns, rows) + bytes(bitmap)
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+  parser.add_argument('input', help='indexed PNG the map is built from')
+  parser.add_argument('output', help='collision bitmap to write')
+  # which indices are terrain depends on how the map was painted, so there
+  # is no default, a map without any terrain passes an empty list
+  mode = parser.add_mutually_exclusive_group(required=True)
+  mode.add_argument('-s', '--solid', type=int, nargs='*',
+                    help='palette indices that mark a tile solid')
+  mode.add_argument('-o', '--opaque', action='store_true',
+                    help='treat every non-transparent pixel as solid')
+  arguments = parser.parse_args()
+
+  if arguments.opaque:
+    solid = set(range(1, 256))
+  else:
+    solid = set(arguments.solid)
+
+  width, height, pixels = indexed_png.read(arguments.input)
+
+  with open(arguments.output, 'wb') as file:
+    file.write(bake(width, height, pixels, solid))
+
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
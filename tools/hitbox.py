@@ -0,0 +1,186 @@
+# MIT License
+#
+# Copyright (c) 2026 Devon Powell
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Bake per-frame hitboxes for sprites listed in a rescomp resource file.
+
+Each animation frame is cut into a few vertical slabs across its opaque pixels
+and every slab is shrunk to the opaque rows it covers, giving a small set of
+boxes that hug the silhouette. Boxes are relative to the frame centre, which is
+where actors keep their position, and a vertically flipped copy of every frame
+is baked too so nothing has to be mirrored at runtime.
+
+The result is a C source and header pair next to the resource file, named
+after the sprite with its "Sprite" suffix swapped for "Hitboxes".
+"""
+
+import argparse
+import os
+import re
+import shlex
+import sys
+
+import indexed_png
+
+TILE_SIZE = 8
+BOXES_MAX = 3  # must match HITBOX_BOXES_MAX in hitbox.h
+SPRITE_PATTERN = re.compile(r'^\s*SPRITE\s+(.*)$')
+
+
+def parse_sprites(path):
+  sprites = {}
+
+  with open(path) as file:
+    for line in file:
+      match = SPRITE_PATTERN.match(line)
+
+      if not match:
+        continue
+
+      name, image, width, height = shlex.split(match.group(1))[:4]
+      image = os.path.join(os.path.dirname(path), image)
+      sprites[name] = (image, int(width) * TILE_SIZE, int(height) * TILE_SIZE)
+
+  return sprites
+
+
+def slice_frame(pixels, left, top, width, height):
+  columns = [x for x in range(width)
+             if any(pixels[top + y][left + x] for y in range(height))]
+
+  if not columns:
+    return []
+
+  first = columns[0]
+  span = columns[-1] - first + 1
+  boxes = []
+
+  for slab in range(BOXES_MAX):
+    start = first + span * slab // BOXES_MAX
+    end = first + span * (slab + 1) // BOXES_MAX
+    rows = [y for y in range(height)
+            if any(pixels[top + y][left + x] for x in range(start, end))]
+
+    if end > start and rows:
+      boxes.append((start - width // 2, rows[0] - height // 2, end - start,
+                    rows[-1] - rows[0] + 1))
+
+  return boxes
+
+
+def flip_boxes(boxes):
+  return [(x, -y - h, w, h) for x, y, w, h in boxes]
+
+
+def get_radius(boxes):
+  reach = [0]
+
+  for x, y, w, h in boxes:
+    reach += [abs(x), abs(x + w), abs(y), abs(y + h)]
+
+  return max(reach)
+
+
+def format_hitbox(boxes, comment):
+  cells = [f'{{{x}, {y}, {w}, {h}}}' for x, y, w, h in boxes]
+
+  while len(cells) < BOXES_MAX:
+    cells.append('{0, 0, 0, 0}')
+
+  return (f'  {{{len(boxes)}, {get_radius(boxes)}, '
+          f'{{{", ".join(cells)}}}}},  // {comment}')
+
+
+def bake(name, image, frame_width, frame_height):
+  if frame_width > 255 or frame_height > 255:
+    raise ValueError(f'{name} is too large to have hitboxes')
+
+  width, height, pixels = indexed_png.read(image)
+  columns = width // frame_width
+  rows = height // frame_height
+  frames = []
+
+  for row in range(rows):
+    for column in range(columns):
+      frames.append((f'animation {row}, frame {column}',
+                     slice_frame(pixels, column * frame_width,
+                                 row * frame_height, frame_width,
+                                 frame_height)))
+
+  base = name[:-len('Sprite')] if name.endswith('Sprite') else name
+  sheet = f'{base}Hitboxes'
+  table = f'{base}HitboxFrames'
+  lines = [f'static const Hitbox {table}[] = {{']
+  lines += [format_hitbox(boxes, comment) for comment, boxes in frames]
+  lines += [format_hitbox(flip_boxes(boxes), f'{comment}, flipped')
+            for comment, boxes in frames]
+  lines[-1] = lines[-1].replace('},  //', '}   //', 1)
+  lines += [
+    '};',
+    '',
+    f'const HitboxSheet {sheet} = {{',
+    f'  {columns},  // frames per animation',
+    f'  {len(frames)},  // frames per orientation',
+    f'  {table}',
+    '};',
+  ]
+
+  return sheet, '\n'.join(lines)
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+  parser.add_argument('resources', help='rescomp file listing the sprites')
+  parser.add_argument('output', help='path of the source and header to write, '
+                      'without the extension')
+  parser.add_argument('sprites', nargs='+', help='sprites to bake')
+  arguments = parser.parse_args()
+  sprites = parse_sprites(arguments.resources)
+  header = os.path.basename(arguments.output) + '.h'
+  guard = f'__QUANTUM_BURST_{header.upper().replace(".", "_")}__'
+  sheets = []
+  sources = []
+
+  for name in arguments.sprites:
+    sheet, source = bake(name, *sprites[name])
+
+    sheets.append(sheet)
+    sources.append(source)
+
+  notice = '// generated by tools/hitbox.py, do not edit'
+
+  with open(arguments.output + '.h', 'w') as file:
+    file.write('\n'.join([
+      notice, '', f'#ifndef {guard}', f'#define {guard}', '',
+      '#include "hitbox.h"', ''
+    ] + [f'extern const HitboxSheet {sheet};' for sheet in sheets] + [
+      '', f'#endif  // {guard}', ''
+    ]))
+
+  with open(arguments.output + '.c', 'w') as file:
+    file.write('\n'.join([notice, '', f'#include "{header}"', '',
+                          '\n\n'.join(sources), '']))
+
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
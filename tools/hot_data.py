@@ -0,0 +1,208 @@
+# MIT License
+#
+# Copyright (c) 2026 Devon Powell
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Report where the hot data and everything around it ended up in work RAM.
+
+Hot variables are the members of one struct placed at the top of RAM, see
+game/inc/hot_data.h, so the 68000 reaches them with 16-bit absolute short
+addressing. This lays the struct out the way m68k GCC does, lists the members
+with their addresses and, given the symbol table a build leaves in
+game/out/symbol.txt, checks the stack and every linked RAM symbol stay clear
+of the block and shows which of them happen to sit in the short addressable
+top 32 KB too:
+
+  python tools/hot_data.py game/out/symbol.txt
+
+It exits with an error when anything overlaps the block, so it can run after
+a build.
+"""
+
+import argparse
+import glob
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+HEADER = os.path.join(ROOT, 'game', 'inc', 'hot_data.h')
+WORK_RAM = 0xFF0000
+SHORT_RAM = 0xFF8000  # first address absolute short addressing reaches
+POINTER_SIZE = 4
+SIZES = {
+  'bool': 1, 'char': 1, 'u8': 1, 's8': 1,
+  'u16': 2, 's16': 2, 'f16': 2,
+  'u32': 4, 's32': 4, 'f32': 4,
+  'V2u16': 4, 'V2s16': 4, 'V2f16': 4,
+  'V2u32': 8, 'V2s32': 8, 'V2f32': 8
+}
+DEFINE_PATTERN = re.compile(r'^#define HOT_DATA_(\w+) (0x[0-9A-Fa-f]+|\d+)')
+STRUCT_PATTERN = re.compile(r'typedef struct \{(.*?)\} (\w+);', re.S)
+FIELD_PATTERN = re.compile(r'^\s*(?:const )?(?:struct )?(\w+)\s*(\*?)\s*'
+                           r'(\w+)(?:\[(\d+)\])?;\s*(?://\s*(.*))?$')
+SYMBOL_PATTERN = re.compile(r'^([0-9A-Fa-f]+)\s+(?:([0-9A-Fa-f]+)\s+)?'
+                            r'([A-Za-z])\s+(\S+)$')
+
+
+def parse_structs(paths):
+  structs = {}
+
+  for path in paths:
+    with open(path) as file:
+      for body, name in STRUCT_PATTERN.findall(file.read()):
+        structs[name] = [match.groups() for match in
+                         map(FIELD_PATTERN.match, body.splitlines()) if match]
+
+  return structs
+
+
+def lay_out(name, structs, layouts):
+  # m68k GCC aligns anything wider than a byte to a word, structs included
+  if name in layouts:
+    return layouts[name]
+
+  if name not in structs:
+    raise ValueError(f'unknown type {name}, add it to SIZES')
+
+  members = []
+  offset = 0
+  alignment = 1
+
+  for kind, pointer, member, count, comment in structs[name]:
+    size = POINTER_SIZE if pointer else layout_size(kind, structs, layouts)
+    size *= int(count or 1)
+    step = 2 if size > 1 else 1
+    offset = (offset + step - 1) // step * step
+    alignment = max(alignment, step)
+
+    members.append((member, offset, size, kind + pointer, comment or ''))
+    offset += size
+
+  size = (offset + alignment - 1) // alignment * alignment
+  layouts[name] = (members, size)
+
+  return layouts[name]
+
+
+def layout_size(kind, structs, layouts):
+  return SIZES[kind] if kind in SIZES else lay_out(kind, structs, layouts)[1]
+
+
+def parse_header(path):
+  constants = {}
+
+  with open(path) as file:
+    for line in file:
+      match = DEFINE_PATTERN.match(line)
+
+      if match:
+        constants[match.group(1)] = int(match.group(2), 0)
+
+  headers = glob.glob(os.path.join(os.path.dirname(path), '**', '*.h'),
+                      recursive=True)
+  members, used = lay_out('HotData', parse_structs(headers), {})
+
+  return constants['START'], constants['SIZE'], used, members
+
+
+def parse_symbols(path):
+  symbols = []
+
+  with open(path) as file:
+    for line in file:
+      match = SYMBOL_PATTERN.match(line.strip())
+
+      if match:
+        address, size, kind, name = match.groups()
+        symbols.append((int(address, 16) & 0xFFFFFF,
+                        int(size, 16) if size else 0, kind, name))
+
+  return symbols
+
+
+def report_members(start, size, used, members):
+  print(f'hot data: 0x{start:06X}-0x{start + size - 1:06X}, '
+        f'{used} of {size} bytes used')
+
+  for name, offset, length, kind, comment in members:
+    print(f'  0x{start + offset:06X}  {length:3} bytes  '
+          f'{kind:<16} {name:<20} {comment}')
+
+
+def report_symbols(start, size, symbols):
+  problems = 0
+  stack = [address for address, _, _, name in symbols if name == '__stack']
+
+  if not stack:
+    print('__stack not found, the stack may still start at the top of RAM')
+
+    problems += 1
+  elif stack[0] > start:
+    print(f'__stack is 0x{stack[0]:06X}, it must not be above 0x{start:06X}')
+
+    problems += 1
+
+  ram = [symbol for symbol in symbols
+         if WORK_RAM <= symbol[0] < start + size and symbol[3] != '__stack']
+  short = []
+
+  for address, length, kind, name in ram:
+    if address + max(length, 1) > start:
+      print(f'{name} at 0x{address:06X} overlaps the hot data')
+
+      problems += 1
+    elif address >= SHORT_RAM and kind.lower() in 'bdc':
+      short.append((address, length, name))
+
+  print(f'{len(short)} other RAM symbols in the short addressable range')
+
+  for address, length, name in short:
+    print(f'  0x{address:06X}  {length:5} bytes  {name}')
+
+  return problems
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+  parser.add_argument('symbols', nargs='?',
+                      help='symbol table of a build, out/symbol.txt')
+  parser.add_argument('--header', default=HEADER,
+                      help='hot_data.h to read the layout from, the '
+                      'headers next to it are searched for the types')
+  arguments = parser.parse_args()
+  start, size, used, members = parse_header(arguments.header)
+
+  report_members(start, size, used, members)
+
+  if used > size:
+    print('hot data overflows its block')
+
+    return 1
+
+  if arguments.symbols is None:
+    return 0
+
+  return 1 if report_symbols(start, size,
+                             parse_symbols(arguments.symbols)) else 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,122 @@
+# MIT License
+#
+# Copyright (c) 2026 Devon Powell
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Minimal reader for the indexed PNG files the resources are drawn in."""
+
+import struct
+import zlib
+
+PNG_SIGNATURE = b'\x89PNG\r\n\x1a\n'
+PNG_COLOR_TYPE_INDEXED = 3
+
+
+def paeth(a, b, c):
+  p = a + b - c
+  pa = abs(p - a)
+  pb = abs(p - b)
+  pc = abs(p - c)
+
+  if pa <= pb and pa <= pc:
+    return a
+
+  if pb <= pc:
+    return b
+
+  return c
+
+
+def unfilter(data, width, height, bit_depth):
+  stride = (width * bit_depth + 7) // 8
+  bpp = max(1, bit_depth // 8)
+  previous = bytearray(stride)
+  rows = []
+  offset = 0
+
+  for _ in range(height):
+    kind = data[offset]
+    row = bytearray(data[offset + 1:offset + 1 + stride])
+    offset += 1 + stride
+
+    for i in range(stride):
+      a = row[i - bpp] if i >= bpp else 0
+      b = previous[i]
+      c = previous[i - bpp] if i >= bpp else 0
+
+      if kind == 1:
+        row[i] = (row[i] + a) & 0xFF
+      elif kind == 2:
+        row[i] = (row[i] + b) & 0xFF
+      elif kind == 3:
+        row[i] = (row[i] + (a + b) // 2) & 0xFF
+      elif kind == 4:
+        row[i] = (row[i] + paeth(a, b, c)) & 0xFF
+
+    rows.append(row)
+    previous = row
+
+  return rows
+
+
+def read(path):
+  with open(path, 'rb') as file:
+    data = file.read()
+
+  if data[:8] != PNG_SIGNATURE:
+    raise ValueError(f'{path} is not a PNG file')
+
+  offset = 8
+  header = None
+  compressed = b''
+
+  while offset < len(data):
+    length, kind = struct.unpack('>I4s', data[offset:offset + 8])
+    chunk = data[offset + 8:offset + 8 + length]
+    offset += 12 + length
+
+    if kind == b'IHDR':
+      header = struct.unpack('>IIBBBBB', chunk)
+    elif kind == b'IDAT':
+      compressed += chunk
+    elif kind == b'IEND':
+      break
+
+  width, height, bit_depth, color_type, _, _, interlace = header
+
+  if color_type != PNG_COLOR_TYPE_INDEXED or interlace != 0:
+    raise ValueError(f'{path} must be an indexed, non-interlaced PNG')
+
+  rows = unfilter(zlib.decompress(compressed), width, height, bit_depth)
+  mask = (1 << bit_depth) - 1
+  pixels = []
+
+  for row in rows:
+    indices = []
+
+    for x in range(width):
+      bit = x * bit_depth
+      shift = 8 - bit_depth - (bit % 8)
+
+      indices.append((row[bit // 8] >> shift) & mask)
+
+    pixels.append(indices)
+
+  return width, height, pixels
@@ -0,0 +1,180 @@
+# MIT License
+#
+# Copyright (c) 2026 Devon Powell
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Sample motion paths into per-frame fix16 delta tables.
+
+A path file holds blocks like the one below, where x and y are Python
+expressions giving the offset in pixels from where the path starts. They can
+use t (0 to 1 over the path), s (seconds) and anything from the math module.
+
+  path wave 2 loop
+    x = 0
+    y = 16 * sin(2 * pi * t)
+
+Every path is sampled once per frame for NTSC and PAL. Deltas are taken
+between rounded positions so adding them up lands exactly on the curve and
+following a path costs one table read and an add per frame.
+
+Paths are also listed in k_paths in file order, with a PATH_<NAME> index each,
+so scripts can refer to them by number.
+"""
+
+import argparse
+import math
+import os
+import sys
+
+FRAME_RATES = (('Ntsc', 60), ('Pal', 50))  # same order as getFrameRateIndex()
+FIX16_ONE = 1 << 6
+FIX16_LIMIT = 1 << 15
+VALUES_PER_LINE = 4
+
+
+def parse_paths(path):
+  paths = []
+  current = None
+
+  with open(path) as file:
+    for number, line in enumerate(file, 1):
+      text = line.split('#', 1)[0].strip()
+
+      if not text:
+        continue
+
+      if text.startswith('path '):
+        name, seconds, mode = text.split()[1:]
+
+        if mode not in ('once', 'loop'):
+          raise ValueError(f'{path}:{number}: mode must be once or loop')
+
+        current = {'name': name, 'seconds': float(seconds),
+                   'loop': mode == 'loop'}
+        paths.append(current)
+      elif current is not None and '=' in text:
+        axis, expression = (part.strip() for part in text.split('=', 1))
+        current[axis] = compile(expression, f'{path}:{number}', 'eval')
+      else:
+        raise ValueError(f'{path}:{number}: unexpected "{text}"')
+
+  return paths
+
+
+def sample(path, frame_rate):
+  frames = max(1, round(path['seconds'] * frame_rate))
+  scope = {name: getattr(math, name) for name in dir(math)
+           if not name.startswith('_')}
+  positions = []
+
+  for frame in range(frames + 1):
+    scope['t'] = frame / frames
+    scope['s'] = frame / frame_rate
+    positions.append(tuple(
+      round(eval(path[axis], scope) * FIX16_ONE) for axis in ('x', 'y')))
+
+  deltas = []
+
+  for previous, current in zip(positions, positions[1:]):
+    delta = (current[0] - previous[0], current[1] - previous[1])
+
+    if any(abs(value) >= FIX16_LIMIT for value in delta):
+      raise ValueError(f'{path["name"]} moves too far in a single frame')
+
+    deltas.append(delta)
+
+  return deltas
+
+
+def bake(path):
+  name = path['name']
+  sources = []
+  entries = []
+
+  for suffix, frame_rate in FRAME_RATES:
+    table = f'k_{name}Path{suffix}Deltas'
+    deltas = sample(path, frame_rate)
+    cells = [f'{{{x}, {y}}}' for x, y in deltas]
+    lines = [', '.join(cells[i:i + VALUES_PER_LINE])
+             for i in range(0, len(cells), VALUES_PER_LINE)]
+
+    sources.append('\n'.join(
+      [f'static const V2f16 {table}[] = {{'] +
+      [f'  {line},' for line in lines[:-1]] + [f'  {lines[-1]}', '};']))
+    entries.append((table, len(deltas), suffix.lower()))
+
+  loop = 'TRUE' if path['loop'] else 'FALSE'
+  cells = [f'  {{{table}, {length}, {loop}}},' for table, length, _ in entries]
+  cells[-1] = cells[-1].rstrip(',')
+  width = max(len(cell) for cell in cells) + 2
+  rows = [f'{cell.ljust(width)}// {rate}'
+          for cell, (_, _, rate) in zip(cells, entries)]
+  sheet = f'k_{name}Paths'
+
+  sources.append('\n'.join([f'const Path {sheet}[] = {{'] + rows + ['};']))
+
+  return sheet, '\n\n'.join(sources)
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+  parser.add_argument('input', help='path definitions to sample')
+  parser.add_argument('output', help='path of the source and header to write, '
+                      'without the extension')
+  arguments = parser.parse_args()
+  header = os.path.basename(arguments.output) + '.h'
+  guard = f'__QUANTUM_BURST_{header.upper().replace(".", "_")}__'
+  paths = parse_paths(arguments.input)
+  sheets = []
+  sources = []
+
+  for path in paths:
+    sheet, source = bake(path)
+
+    sheets.append(sheet)
+    sources.append(source)
+
+  notice = '// generated by tools/path.py, do not edit'
+
+  names = [path['name'] for path in paths]
+  indices = [f'#define PATH_{name.upper()} {index}'
+             for index, name in enumerate(names)]
+  listing = '\n'.join(['const Path* const k_paths[] = {'] +
+                       [f'  {sheet},' for sheet in sheets[:-1]] +
+                       [f'  {sheets[-1]}', '};'])
+
+  with open(arguments.output + '.h', 'w') as file:
+    file.write('\n'.join([
+      notice, '', f'#ifndef {guard}', f'#define {guard}', '',
+      '#include "path.h"', ''
+    ] + indices + [f'#define PATH_COUNT {len(names)}', ''] +
+      [f'extern const Path {sheet}[];' for sheet in sheets] + [
+      'extern const Path* const k_paths[];', '', f'#endif  // {guard}', ''
+    ]))
+
+  with open(arguments.output + '.c', 'w') as file:
+    file.write('\n'.join([notice, '', f'#include "{header}"', '',
+                          '\n\n'.join(sources + [listing]), '']))
+
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,233 @@
+# MIT License
+#
+# Copyright (c) 2026 Devon Powell
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Report ROM and RAM use per module and dump the code of the hot functions.
+
+Run by build.sh after a Profile build. Every symbol of game/out/rom.out is
+put down to the source file it came from, using the line numbers nm reads
+from the debug info, or the file defining the name when nm has none. The
+report is written to game/out/profile/report.txt along with a listing of
+every function in HOT_FUNCTIONS, so both can be diffed between builds:
+
+  python tools/profile.py
+  python tools/profile.py --baseline old/report.json
+
+Functions are counted as ROM, read only data as ROM, initialized data as both
+ROM and RAM and zeroed data as RAM. Everything not from game/src, SGDK and
+libgcc mostly, is reported under "other".
+"""
+
+import argparse
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+GAME = os.path.join(ROOT, 'game')
+SOURCES = os.path.join(GAME, 'src')
+OUT = os.path.join(GAME, 'out')
+HOT_FUNCTIONS = (
+  'updateManagedActors', 'drawManagedActors', 'updateActor', 'projectActor',
+  'projectActorListC', 'projectActorListAsm', 'getApproximatedDistance',
+  'getFastDistanceAsm', 'isHitboxOverlapping', 'updateParticles',
+  'drawParticles', 'updateStage', 'resolveStageMovement',
+)
+SYMBOL_PATTERN = re.compile(r'^([0-9a-f]+) ([0-9a-f]+) ([A-Za-z]) (\S+)'
+                            r'(?:\t(.+):\d+)?$')
+DEFINITION_PATTERN = re.compile(r'^[A-Za-z].*?\b(\w+)(?:\[.*\])?\s*[(=;]',
+                                re.MULTILINE)
+WORK_RAM = 0xFF0000
+KINDS = {'t': 'text', 'r': 'rodata', 'd': 'data', 'b': 'bss'}
+
+
+def find_tool(names, override):
+  if override:
+    return override
+
+  for name in names:
+    if shutil.which(name):
+      return name
+
+  raise FileNotFoundError(f'none of {", ".join(names)} found on the path')
+
+
+def index_sources():
+  # names are only used when they are defined in exactly one file, the
+  # static callbacks every enemy has are left to the debug info
+  owners = {}
+
+  for directory, _, files in os.walk(SOURCES):
+    for name in files:
+      if not name.endswith(('.c', '.s')):
+        continue
+
+      path = os.path.join(directory, name)
+      module = os.path.relpath(path, SOURCES)
+
+      with open(path) as file:
+        text = file.read()
+
+      names = set(DEFINITION_PATTERN.findall(text))
+      names |= set(re.findall(r'^\s*\.globl\s+(\w+)', text, re.MULTILINE))
+
+      for symbol in names:
+        owners.setdefault(symbol, set()).add(module)
+
+  return {symbol: modules.pop() for symbol, modules in owners.items()
+          if len(modules) == 1}
+
+
+def get_module(name, path, owners):
+  if path:
+    path = os.path.normpath(path)
+
+    if path.startswith(SOURCES + os.sep):
+      return os.path.relpath(path, SOURCES)
+
+    return 'other'
+
+  # LTO renames statics it moves between partitions
+  return owners.get(name.split('.')[0], 'other')
+
+
+def read_symbols(nm, elf):
+  output = subprocess.run([nm, '-S', '-l', '-n', elf], check=True,
+                          capture_output=True, text=True).stdout
+  symbols = []
+
+  for line in output.splitlines():
+    match = SYMBOL_PATTERN.match(line)
+
+    if match:
+      address, size, kind, name, path = match.groups()
+      symbols.append((int(address, 16), int(size, 16), kind.lower(), name,
+                      path))
+
+  return symbols
+
+
+def tally(symbols, owners):
+  modules = {}
+
+  for address, size, kind, name, path in symbols:
+    if kind not in KINDS:
+      continue
+
+    # constants in RAM are still data, ROM is below work RAM
+    if kind == 'r' and address >= WORK_RAM:
+      kind = 'd'
+
+    module = modules.setdefault(get_module(name, path, owners),
+                                dict.fromkeys(KINDS.values(), 0))
+    module[KINDS[kind]] += size
+
+  for module in modules.values():
+    module['rom'] = module['text'] + module['rodata'] + module['data']
+    module['ram'] = module['data'] + module['bss']
+
+  return modules
+
+
+def format_report(modules, baseline, rom_size):
+  lines = [f'rom.bin: {rom_size} bytes', '',
+           f'{"module":<36}{"rom":>8}{"ram":>8}{"text":>8}{"rodata":>8}'
+           f'{"data":>8}{"bss":>8}']
+
+  for name in sorted(modules, key=lambda name: -modules[name]['rom']):
+    module = modules[name]
+    cells = [f'{module[key]:>8}' for key in
+             ('rom', 'ram', 'text', 'rodata', 'data', 'bss')]
+    line = f'{name:<36}' + ''.join(cells)
+
+    if baseline is not None:
+      previous = baseline.get(name, {'rom': 0, 'ram': 0})
+      line += (f'  rom {module["rom"] - previous["rom"]:+}, '
+               f'ram {module["ram"] - previous["ram"]:+}')
+
+    lines.append(line)
+
+  totals = {key: sum(module[key] for module in modules.values())
+            for key in ('rom', 'ram')}
+  lines += ['', f'total: {totals["rom"]} bytes rom, {totals["ram"]} bytes ram']
+
+  return '\n'.join(lines) + '\n'
+
+
+def dump_functions(objdump, elf, directory):
+  for function in HOT_FUNCTIONS:
+    listing = subprocess.run([objdump, '-d', f'--disassemble={function}',
+                              '--no-show-raw-insn', elf], check=True,
+                             capture_output=True, text=True).stdout
+
+    if f'<{function}>:' not in listing:
+      print(f'{function} not found, inlined or dropped')
+
+      continue
+
+    with open(os.path.join(directory, f'{function}.s'), 'w') as file:
+      file.write(listing)
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+  parser.add_argument('--elf', default=os.path.join(OUT, 'rom.out'),
+                      help='linked ROM to report on')
+  parser.add_argument('--output', default=os.path.join(OUT, 'profile'),
+                      help='directory to write the report and listings to')
+  parser.add_argument('--baseline',
+                      help='report.json of an earlier build to compare with')
+  parser.add_argument('--nm', help='nm to use, m68k-elf-nm by default')
+  parser.add_argument('--objdump',
+                      help='objdump to use, m68k-elf-objdump by default')
+  arguments = parser.parse_args()
+  nm = find_tool(('m68k-elf-nm', 'nm'), arguments.nm)
+  objdump = find_tool(('m68k-elf-objdump', 'objdump'), arguments.objdump)
+  modules = tally(read_symbols(nm, arguments.elf), index_sources())
+  baseline = None
+
+  if arguments.baseline:
+    with open(arguments.baseline) as file:
+      baseline = json.load(file)
+
+  rom = os.path.join(os.path.dirname(arguments.elf), 'rom.bin')
+  rom_size = os.path.getsize(rom) if os.path.exists(rom) else 0
+  report = format_report(modules, baseline, rom_size)
+
+  os.makedirs(arguments.output, exist_ok=True)
+
+  with open(os.path.join(arguments.output, 'report.txt'), 'w') as file:
+    file.write(report)
+
+  with open(os.path.join(arguments.output, 'report.json'), 'w') as file:
+    json.dump(modules, file, indent=2, sort_keys=True)
+
+  dump_functions(objdump, arguments.elf, arguments.output)
+  print(report, end='')
+
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
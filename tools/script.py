@@ -0,0 +1,216 @@
+# MIT License
+#
+# Copyright (c) 2026 Devon Powell
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Compile enemy behaviour scripts into bytecode for the script VM.
+
+A script file holds blocks of one instruction per line. Times are in seconds
+and speeds in pixels/second; both are converted to frames for NTSC and PAL
+here so the VM never has to scale anything.
+
+  script drifter
+  top:
+    path swoop            # follow a baked path from paths.txt to its end
+    wait 0.5              # do nothing
+    fire aimed            # fire one of the patterns in script.h
+    home 75 2             # steer towards the player at 75 px/s for 2 s
+    move -120 0 1         # move at -120, 0 px/s for 1 s
+    jump top              # carry on from a label
+    despawn               # remove the enemy
+
+Operands are stored big-endian straight after their opcode.
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+import path as paths_tool
+
+FRAME_RATES = (('Ntsc', 60), ('Pal', 50))  # same order as getFrameRateIndex()
+FIX16_ONE = 1 << 6
+BYTES_PER_LINE = 12
+
+# must match SCRIPT_OP_* and SCRIPT_PATTERN_* in script.h
+OPCODES = {
+  'despawn': 0x00,
+  'wait': 0x01,
+  'move': 0x02,
+  'path': 0x03,
+  'home': 0x04,
+  'fire': 0x05,
+  'jump': 0x06,
+}
+PATTERNS = ('aimed', 'spread', 'ring')
+
+
+def parse_scripts(path):
+  scripts = []
+  current = None
+
+  with open(path) as file:
+    for number, line in enumerate(file, 1):
+      text = line.split('#', 1)[0].strip()
+      where = f'{path}:{number}'
+
+      if not text:
+        continue
+
+      if text.startswith('script '):
+        current = {'name': text.split()[1], 'lines': []}
+        scripts.append(current)
+      elif current is None:
+        raise ValueError(f'{where}: instruction outside of a script')
+      else:
+        current['lines'].append((where, text))
+
+  return scripts
+
+
+def to_frames(seconds, frame_rate):
+  return max(1, round(float(seconds) * frame_rate))
+
+
+def to_velocity(speed, frame_rate):
+  return round(float(speed) / frame_rate * FIX16_ONE)
+
+
+def assemble(script, frame_rate, path_names):
+  code = bytearray()
+  labels = {}
+  jumps = []
+  operation = None
+
+  for where, text in script['lines']:
+    if text.endswith(':'):
+      labels[text[:-1]] = len(code)
+      operation = None
+
+      continue
+
+    operation, *operands = text.split()
+
+    if operation not in OPCODES:
+      raise ValueError(f'{where}: unknown instruction "{operation}"')
+
+    code.append(OPCODES[operation])
+
+    if operation == 'wait':
+      code += struct.pack('>H', to_frames(operands[0], frame_rate))
+    elif operation == 'move':
+      x, y, seconds = operands
+      code += struct.pack('>hhH', to_velocity(x, frame_rate),
+                          to_velocity(y, frame_rate),
+                          to_frames(seconds, frame_rate))
+    elif operation == 'path':
+      code += struct.pack('>B', path_names.index(operands[0]))
+    elif operation == 'home':
+      speed, seconds = operands
+      code += struct.pack('>hH', to_velocity(speed, frame_rate),
+                          to_frames(seconds, frame_rate))
+    elif operation == 'fire':
+      code += struct.pack('>B', PATTERNS.index(operands[0]))
+    elif operation == 'jump':
+      jumps.append((where, len(code), operands[0]))
+      code += b'\0\0'
+
+  for where, offset, label in jumps:
+    if label not in labels:
+      raise ValueError(f'{where}: unknown label "{label}"')
+
+    code[offset:offset + 2] = struct.pack('>H', labels[label])
+
+  # running off the end of a script is the same as despawning
+  if operation not in ('despawn', 'jump'):
+    code.append(OPCODES['despawn'])
+
+  return bytes(code)
+
+
+def bake(script, path_names):
+  name = script['name']
+  sources = []
+  entries = []
+
+  for suffix, frame_rate in FRAME_RATES:
+    table = f'k_{name}Script{suffix}Code'
+    code = assemble(script, frame_rate, path_names)
+    cells = [f'0x{value:02X}' for value in code]
+    lines = [', '.join(cells[i:i + BYTES_PER_LINE])
+             for i in range(0, len(cells), BYTES_PER_LINE)]
+
+    sources.append('\n'.join(
+      [f'static const u8 {table}[] = {{'] +
+      [f'  {line},' for line in lines[:-1]] + [f'  {lines[-1]}', '};']))
+    entries.append((table, len(code), suffix.lower()))
+
+  cells = [f'  {{{table}, {length}}},' for table, length, _ in entries]
+  cells[-1] = cells[-1].rstrip(',')
+  width = max(len(cell) for cell in cells) + 2
+  rows = [f'{cell.ljust(width)}// {rate}'
+          for cell, (_, _, rate) in zip(cells, entries)]
+  sheet = f'k_{name}Scripts'
+
+  sources.append('\n'.join([f'const Script {sheet}[] = {{'] + rows + ['};']))
+
+  return sheet, '\n\n'.join(sources)
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+  parser.add_argument('input', help='scripts to compile')
+  parser.add_argument('paths', help='path definitions scripts can follow')
+  parser.add_argument('output', help='path of the source and header to write, '
+                      'without the extension')
+  arguments = parser.parse_args()
+  path_names = [path['name'] for path in
+                paths_tool.parse_paths(arguments.paths)]
+  header = os.path.basename(arguments.output) + '.h'
+  guard = f'__QUANTUM_BURST_{header.upper().replace(".", "_")}__'
+  sheets = []
+  sources = []
+
+  for script in parse_scripts(arguments.input):
+    sheet, source = bake(script, path_names)
+
+    sheets.append(sheet)
+    sources.append(source)
+
+  notice = '// generated by tools/script.py, do not edit'
+
+  with open(arguments.output + '.h', 'w') as file:
+    file.write('\n'.join([
+      notice, '', f'#ifndef {guard}', f'#define {guard}', '',
+      '#include "script.h"', ''
+    ] + [f'extern const Script {sheet}[];' for sheet in sheets] + [
+      '', f'#endif  // {guard}', ''
+    ]))
+
+  with open(arguments.output + '.c', 'w') as file:
+    file.write('\n'.join([notice, '', f'#include "{header}"', '',
+                          '\n\n'.join(sources), '']))
+
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,146 @@
+# MIT License
+#
+# Copyright (c) 2026 Devon Powell
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Summarise an autoplay soak from the emulator's debug log.
+
+A ROM built with --autoplay plays menu, stage and credits on its own forever
+and logs a few lines through kprintf at the end of every loop, see
+game/src/input.c. Point the emulator's debug message output at a file, leave
+it running for as long as needed and run:
+
+  python tools/soak.py soak.log
+
+Every loop is printed as one row. What the game holds between loops should
+never change, so heap, sprites and VRAM left over are compared with the first
+loop and any drift is reported as a leak, as is the worst frame time creeping
+up between the first and last quarter of the run.
+"""
+
+import argparse
+import re
+import sys
+
+PATTERNS = {
+  'loop': re.compile(r'autoplay: loop (\d+), (\d+) s played'),
+  'heap': re.compile(r'autoplay: heap (\d+) free, (\d+) largest block'),
+  'sprites': re.compile(r'autoplay: sprites (\d+) peak, (\d+) left'),
+  'vram': re.compile(r'autoplay: vram (\d+) tiles free at worst, (\d+) after'),
+  'arena': re.compile(r'autoplay: arena (\d+) bytes peak'),
+  'frame': re.compile(r'autoplay: frame (\d+) vblanks, (\d+)% cpu at worst, '
+                      r'(\d+) lag frames'),
+}
+COLUMNS = (
+  ('loop', 'loop', 0), ('seconds', 'loop', 1), ('heap', 'heap', 0),
+  ('largest', 'heap', 1), ('sprites', 'sprites', 0), ('left', 'sprites', 1),
+  ('vram', 'vram', 0), ('after', 'vram', 1), ('arena', 'arena', 0),
+  ('frame', 'frame', 0), ('cpu', 'frame', 1), ('lag', 'frame', 2),
+)
+# (column, what leaking looks like) for values that must hold from loop to loop
+STEADY = (('heap', 'heap free went down'),
+          ('largest', 'largest heap block went down'),
+          ('left', 'sprites left behind went up'),
+          ('after', 'free VRAM went down'))
+
+
+def parse_log(path):
+  loops = []
+  current = None
+
+  with open(path, errors='replace') as file:
+    for line in file:
+      for name, pattern in PATTERNS.items():
+        match = pattern.search(line)
+
+        if not match:
+          continue
+
+        # a loop always starts with its number, anything before is partial
+        if name == 'loop':
+          current = {}
+          loops.append(current)
+
+        if current is not None:
+          current[name] = tuple(int(value) for value in match.groups())
+
+  # the last loop can be cut off when the emulator is closed
+  return [loop for loop in loops if len(loop) == len(PATTERNS)]
+
+
+def to_row(loop):
+  return {column: loop[name][index] for column, name, index in COLUMNS}
+
+
+def find_leaks(rows):
+  first = rows[0]
+  problems = []
+
+  for column, text in STEADY:
+    changed = [row for row in rows if row[column] != first[column]]
+    worse = [row for row in changed
+             if (row[column] > first[column]) == (column == 'left')]
+
+    if worse:
+      problems.append(f'{text} from loop {worse[0]["loop"]}: '
+                      f'{first[column]} -> {worse[-1][column]}')
+
+  quarter = max(1, len(rows) // 4)
+  early = max(row['frame'] for row in rows[:quarter])
+  late = max(row['frame'] for row in rows[-quarter:])
+
+  if len(rows) >= 4 and late > early:
+    problems.append(f'worst frame time went up: {early} -> {late} vblanks')
+
+  return problems
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+  parser.add_argument('log', help='debug message output of the emulator')
+  arguments = parser.parse_args()
+  rows = [to_row(loop) for loop in parse_log(arguments.log)]
+
+  if not rows:
+    print('no complete autoplay loops found, was the ROM built with '
+          '--autoplay?')
+
+    return 1
+
+  print(' '.join(f'{column:>7}' for column, _, _ in COLUMNS))
+
+  for row in rows:
+    print(' '.join(f'{row[column]:>7}' for column, _, _ in COLUMNS))
+
+  problems = find_leaks(rows)
+
+  print()
+
+  for problem in problems:
+    print(f'leak: {problem}')
+
+  if not problems:
+    print(f'{len(rows)} loops, nothing drifted')
+
+  return 1 if problems else 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,151 @@
+# MIT License
+#
+# Copyright (c) 2026 Devon Powell
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Decode the binary trace ring from a dump of the Mega Drive's work RAM.
+
+The game writes fixed 8 byte records (frame, event and two 16-bit arguments)
+into a RAM ring when it is built with DEBUG or TRACE, see game/inc/trace.h.
+Save the 64 KB of work RAM from an emulator's debugger and run:
+
+  python tools/trace.py ram.bin
+
+The ring is found by its magic number unless --address gives where it starts,
+either as an offset into the dump or as a 68000 address from out/symbol.txt.
+Event names and formats are read straight from the TraceEvent enum so this
+never goes out of date with the game.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+HEADER = os.path.join(ROOT, 'game', 'inc', 'trace.h')
+WORK_RAM = 0xFF0000
+MAGIC = 0x51425452  # must match TRACE_MAGIC in trace.h
+RECORD = struct.Struct('>HHHH')
+HEADER_SIZE = 8
+EVENT_PATTERN = re.compile(r'^\s*TRACE_EVENT_(\w+),?\s*(?://\s*(.*))?$')
+RECORDS_PATTERN = re.compile(r'^#define TRACE_RECORDS (\d+)')
+
+
+def parse_header(path):
+  events = []
+  records = None
+
+  with open(path) as file:
+    for line in file:
+      match = RECORDS_PATTERN.match(line)
+
+      if match:
+        records = int(match.group(1))
+
+        continue
+
+      match = EVENT_PATTERN.match(line)
+
+      if match and match.group(1) != 'COUNT':
+        events.append((match.group(1).lower(), match.group(2) or ''))
+
+  if records is None:
+    raise ValueError(f'{path}: TRACE_RECORDS not found')
+
+  return events, records
+
+
+def find_ring(dump, address):
+  if address is not None:
+    return address - WORK_RAM if address >= WORK_RAM else address
+
+  magic = struct.pack('>I', MAGIC)
+  offset = dump.find(magic)
+
+  # the ring is word aligned, skip any match that lands on an odd byte
+  while offset >= 0 and offset % 2 != 0:
+    offset = dump.find(magic, offset + 1)
+
+  if offset < 0:
+    raise ValueError('trace ring not found, was the game built with tracing?')
+
+  return offset
+
+
+def read_records(dump, offset, capacity):
+  magic, head, count = struct.unpack_from('>IHH', dump, offset)
+
+  if magic != MAGIC:
+    raise ValueError(f'no trace ring at offset 0x{offset:X}')
+
+  start = offset + HEADER_SIZE
+  records = [RECORD.unpack_from(dump, start + i * RECORD.size)
+             for i in range(capacity)]
+
+  # once the ring has wrapped the oldest record is the one about to be
+  # overwritten
+  if count < capacity:
+    return records[:count]
+
+  return records[head:] + records[:head]
+
+
+def format_record(record, previous, events):
+  frame, event, argument1, argument2 = record
+  delta = 0 if previous is None else (frame - previous) & 0xFFFF
+
+  if event < len(events):
+    name, text = events[event]
+    arguments = iter((argument1, argument2))
+    text = re.sub(r'%u', lambda _: str(next(arguments)), text) or name
+  else:
+    text = f'unknown event {event} ({argument1}, {argument2})'
+
+  return f'{frame:5d} +{delta:<5d} {text}'
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+  parser.add_argument('dump', help='work RAM dump to read the ring from')
+  parser.add_argument('-a', '--address', type=lambda text: int(text, 0),
+                      help='where the ring starts, found by magic if omitted')
+  parser.add_argument('--header', default=HEADER,
+                      help='trace.h to read the event formats from')
+  arguments = parser.parse_args()
+  events, capacity = parse_header(arguments.header)
+
+  with open(arguments.dump, 'rb') as file:
+    dump = file.read()
+
+  offset = find_ring(dump, arguments.address)
+  previous = None
+
+  for record in read_records(dump, offset, capacity):
+    print(format_record(record, previous, events))
+
+    previous = record[0]
+
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())